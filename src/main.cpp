@@ -1,4 +1,5 @@
 #include <ranges>
+#include <string>
 #include <vector>
 #include <variant>
 #include <iostream>
@@ -29,6 +30,22 @@ int main() noexcept
 
 #include "doctest.h"
 
+static ptrdiff_t live {0}; // allocations not yet freed
+static size_t    last {0}; // size of the latest one
+
+template <typename T> struct tally
+{
+	using value_type = T;
+
+	constexpr tally() noexcept = default;
+	template <typename U> constexpr tally(const tally<U>&) noexcept {}
+
+	auto allocate(size_t n) -> T* { ++live; last = n; return std::allocator<T> {}.allocate(n); }
+	auto deallocate(T* ptr, size_t n) -> void { --live; std::allocator<T> {}.deallocate(ptr, n); }
+
+	template <typename U> constexpr auto operator==(const tally<U>&) const noexcept -> bool { return true; }
+};
+
 TEST_CASE("string")
 {
 	SUBCASE("SSO23")
@@ -53,6 +70,68 @@ TEST_CASE("string")
 
 		CHECK(str.substr(0, N) == str);
 		CHECK(str.substr(0, 4) == str);
+
+		utf::utf8 big;
+
+		for (int i {0}; i < 100; ++i) { big += u8"티라미수"; }
+
+		CHECK(big[399] == U'수');
+		CHECK(big[256] == U'티');
+
+		big[256] = U'a'; // shrink
+
+		CHECK(big[256] == U'a');
+		CHECK(big[257] == U'라');
+		CHECK(big[399] == U'수');
+
+		big[130] = U'🍰'; // grow
+
+		CHECK(big[130] == U'🍰');
+		CHECK(big[131] == U'수');
+		CHECK(big.substr(256, 258) == u8"a라");
+
+		big.build_index();
+
+		const auto& view {big}; // read only
+
+		CHECK(view[399] == U'수');
+		CHECK(view.substr(256, 258) == u8"a라");
+
+		CHECK(big.length() == 400);
+		big += u"☆";
+		CHECK(big.length() == 401);
+		CHECK(utf::utf16 {big + U"☆"}.length() == 402);
+	}
+
+	SUBCASE("allocator")
+	{
+		{
+			utf::str<utf::codec<"UTF-8">, tally<char8_t>> big;
+
+			for (int i {0}; i < 100; ++i) { big += u8"티라미수"; }
+
+			#ifdef UTF_LENGTH
+			CHECK(live == 2); // the buffer, and a side index to keep count in
+			#else
+			CHECK(live == 1); // the buffer alone
+			#endif
+
+			const auto before {live};
+
+			big.build_index();
+
+			// the side index comes from the same allocator
+			CHECK(before < live);
+			CHECK(big[399] == U'수');
+		}
+		CHECK(live == 0);
+
+		utf::str<utf::codec<"UTF-32">, tally<char32_t>> wide;
+
+		wide.capacity(100);
+
+		// fixed width; nothing reserved in front
+		CHECK(last == 101);
 	}
 
 	SUBCASE("concat")
@@ -74,6 +153,45 @@ TEST_CASE("string")
 
 		CHECK(티라티라 == u8"티라티라");
 		CHECK(티라티라.length() == 4);
+
+		utf::utf8 str {티라 + 미수 + u"☆"};
+
+		CHECK(str == u8"티라미수☆");
+
+		str += 티라 + str;
+		str = 미수 + str;
+
+		CHECK(str == u8"미수티라미수☆티라티라미수☆");
+
+		utf::utf8 all {std::move(str) + u"!" + U"?"};
+
+		CHECK(all == u8"미수티라미수☆티라티라미수☆!?");
+		CHECK(str.size() == 0);
+	}
+
+	SUBCASE("transcode")
+	{
+		utf::utf8 src {u8"the quick brown fox jumps over the lazy dog; "
+		               u8"the quick brown fox jumps over the lazy dog! "
+		               u8"티라미수☆치즈케잌☆말차라떼 🍰🍵 "
+		               u8"티라미수☆치즈케잌☆말차라떼 🍰🍵 "
+		               u8"티라미수☆치즈케잌☆말차라떼 🍰🍵"};
+
+		utf::utf16 u16 {src};
+		utf::utf32 u32 {u16};
+		utf::utf8 u08 {u32};
+
+		CHECK(u16 == src);
+		CHECK(u32 == src);
+		CHECK(u08 == src);
+
+		CHECK(u08.size() == src.size());
+
+		utf::utf32 w32 {src};
+		utf::utf16 w16 {w32};
+
+		CHECK(w32 == u32);
+		CHECK(w16 == u16);
 	}
 
 	SUBCASE("split")
@@ -96,6 +214,92 @@ TEST_CASE("string")
 
 		CHECK(str.split(str).size() == 0);
 		CHECK(str.match(str).size() == 1);
+
+		auto lazy {str.split_view(u"☆")};
+
+		CHECK(std::ranges::equal(lazy, split));
+		CHECK(std::ranges::equal(str.match_view(U"☆"), str.match(U"☆")));
+
+		for (auto piece : lazy | std::views::drop(1) | std::views::take(1))
+		{
+			CHECK(piece == u8"치즈케잌");
+		}
+		CHECK(std::ranges::distance(str.split_view(str)) == 0);
+
+		static_assert(!std::ranges::borrowed_range<decltype(lazy)>);
+
+		const utf::searcher<utf::codec<"UTF-8">> needle {u"☆"};
+
+		static_assert(std::ranges::borrowed_range<decltype(str.split_view(needle))>);
+
+		// the view is gone by the time it is read
+		const auto it {std::ranges::find_if(str.split_view(needle), [](auto piece) { return piece == u8"말차라떼"; })};
+
+		CHECK(*it == u8"말차라떼");
+		CHECK(std::ranges::equal(str.match_view(needle), str.match(u"☆")));
+	}
+
+	SUBCASE("contains")
+	{
+		utf::utf8 str {u8"티라미수"
+		               u8"☆"
+		               u8"티티라"
+		               u8"☆"
+		               u8"aaab"};
+
+		CHECK(str.contains(u8"☆") == 2);
+		CHECK(str.contains(u"티라") == 2);
+		CHECK(str.contains(U"aab") == 1);
+		CHECK(str.contains(u8"aab") == 1);
+
+		CHECK(str.includes(u8"☆티티"));
+		CHECK(str.includes(u"라미"));
+		CHECK(!str.includes(U"ba"));
+
+		CHECK(str.match(u8"aab")[0] == u8"aab");
+
+		CHECK(utf::utf8 {u8"abababab"}.contains(u8"abab") == 2);
+		CHECK(utf::utf8 {u8"abaabaab"}.contains(u8"aab") == 2);
+
+		// long enough for every vector tier to filter it
+		utf::utf8 log {u8"the quick brown fox jumps over the lazy dog; "
+		               u8"티라미수☆치즈케잌☆말차라떼 🍰🍵 "
+		               u8"the quick brown fox jumps over the lazy dog! "
+		               u8"티라미수☆치즈케잌☆말차라떼 🍰🍵 "};
+
+		CHECK(log.contains(u8"the lazy dog") == 2);
+		CHECK(log.contains(u8"🍰🍵 ") == 2);
+		CHECK(log.contains(u8"dog!") == 1);
+		CHECK(log.contains(U"🍰🍵 the") == 1);
+		CHECK(utf::utf16 {log}.contains(u"말차라떼 🍰") == 2);
+		CHECK(utf::utf32 {log}.contains(U"fox jumps") == 2);
+	}
+
+	SUBCASE("find")
+	{
+		utf::utf8 str {u8"티라미수"
+		               u8"☆"
+		               u8"치즈케잌"
+		               u8"☆"
+		               u8"말차라떼"};
+
+		CHECK(str.find(u"☆")->unit == 12);
+		CHECK(str.find(u"☆", utf::index::CODE)->code == 4);
+		CHECK(!str.find(u"☆")->code.has_value());
+
+		CHECK(str.rfind(U"☆")->unit == 27);
+		CHECK(str.rfind(U"☆", utf::index::CODE)->code == 9);
+		CHECK(utf::utf8 {u8"aaa"}.rfind(u8"aa")->unit == 1);
+
+		CHECK(str.find_nth(u8"☆", 1)->unit == 27);
+		CHECK(!str.find_nth(u8"☆", 2).has_value());
+		CHECK(!str.rfind(u8"☆☆").has_value());
+
+		std::vector<utf::offset> out;
+
+		CHECK(str.find_all_into(u"☆", out, utf::index::CODE) == 2);
+		CHECK(out[0].code == 4);
+		CHECK(out[1].code == 9);
 	}
 
 	SUBCASE("range")
@@ -128,6 +332,287 @@ TEST_CASE("string")
 
 		CHECK(std::ranges::equal(foo.begin(), foo.end(),
 		                         bar.begin(), bar.end()));
+
+		utf::utf8 str {u8"티라미수티라"};
+
+		// outgrows SSO halfway through
+		for (auto code : str) { code = U'🍰'; }
+
+		CHECK(str == u8"🍰🍰🍰🍰🍰🍰");
+
+		for (auto code : str | std::views::reverse) { code = U'a'; }
+
+		CHECK(str == u8"aaaaaa");
+	}
+
+	SUBCASE("transform")
+	{
+		utf::utf8 str {u8"티라미수 and 치즈케잌"};
+
+		utf::utf16 out;
+
+		str.transform_into(out, [](char32_t code) { return code < 0x80 ? code : U'?'; }, utf::ascii::KEEP);
+
+		CHECK(out == u"???? and ????");
+
+		str.transform([](char32_t code) { return code == U' ' ? U'🍰' : code; });
+
+		CHECK(str == u8"티라미수🍰and🍰치즈케잌");
+
+		str.transform([](char32_t code) { return code == U'🍰' ? utf::txt {u"☆☆"} : utf::txt {u""}; });
+
+		CHECK(str == u8"☆☆☆☆");
+		CHECK(str.length() == 4);
+	}
+
+	SUBCASE("replace")
+	{
+		utf::utf8 str {u8"티라미수☆치즈케잌☆말차라떼"};
+
+		CHECK(str.replace_all(u"☆", u8", ") == 2); // grows
+
+		CHECK(str == u8"티라미수, 치즈케잌, 말차라떼");
+
+		CHECK(str.replace_n(U", ", u"☆", 1) == 1); // shrinks
+
+		CHECK(str == u8"티라미수☆치즈케잌, 말차라떼");
+
+		CHECK(str.replace_all(str.substr(0, 2), u8"") == 1); // aliases
+
+		CHECK(str == u8"미수☆치즈케잌, 말차라떼");
+		CHECK(str.replace_all(u8"🍰", u8"?") == 0);
+	}
+
+	SUBCASE("edit")
+	{
+		utf::utf8 str {u8"티라미수☆치즈케잌"};
+
+		auto ed {str.edit()};
+
+		ed.replace(4, U','); // shrinks
+		ed.insert(5, u" "); // ahead of the code point
+		ed.erase(0, 2);
+		ed.insert(9, U"!"); // appends
+
+		CHECK(ed.commit() == u8"미수, 치즈케잌!");
+
+		ed.replace(0, U'🍰'); // grows
+		ed.erase(1, 3);
+		ed.replace(2, U'?'); // already erased
+		ed.insert(2, str.substr(4, 6)); // aliases
+
+		CHECK(ed.commit() == u8"🍰치즈치즈케잌!");
+		CHECK(ed.commit() == u8"🍰치즈치즈케잌!");
+	}
+
+	SUBCASE("capacity")
+	{
+		utf::utf8 str;
+
+		str.reserve(64);
+
+		CHECK(64 <= str.capacity());
+
+		for (int i {0}; i < 100; ++i)
+		{
+			str += u8"티라미수";
+		}
+
+		CHECK(str.size() < str.capacity()); // amortized
+		CHECK(str[399] == U'수');
+
+		str.shrink_to_fit();
+
+		CHECK(str.size() == str.capacity());
+		CHECK(str[399] == U'수');
+
+		str = u8"티라미수";
+
+		str.shrink_to_fit(); // back to SSO
+
+		CHECK(str == u8"티라미수");
+		CHECK(str.capacity() == utf::utf8 {}.capacity());
+
+		utf::utf32 wide;
+
+		for (int i {0}; i < 100; ++i) { wide += U"abcd"; }
+
+		const utf::utf8 narrow {wide}; // bound is 4x
+
+		CHECK(narrow.capacity() <= narrow.size() * 2);
+	}
+
+	SUBCASE("length")
+	{
+		// a walk never trusts the count; with UTF_LENGTH, length() does
+		const auto walk {[](const auto& str) { return static_cast<size_t>(std::ranges::distance(str.begin(), str.end())); }};
+
+		utf::utf8 str;
+
+		for (int i {0}; i < 100; ++i) { str += u8"티라미수☆"; }
+
+		CHECK(str.length() == 500);
+		CHECK(str.length() == walk(str));
+
+		str = str + u"치즈" + U"케잌"; // aliases
+
+		CHECK(str.length() == walk(str));
+
+		str[130] = U'a'; // shrink
+		str[131] = U'🍰'; // grow
+
+		CHECK(str.length() == walk(str));
+
+		CHECK(str.replace_all(u"☆", u8", ") == 100);
+
+		CHECK(str.length() == walk(str));
+
+		auto ed {str.edit()};
+
+		ed.replace(0, U'?');
+		ed.insert(7, u"말차");
+		ed.erase(20, 30);
+
+		CHECK(ed.commit().length() == walk(str));
+
+		str.transform([](char32_t code) { return code == U'?' ? U'🍰' : code; }, utf::ascii::KEEP);
+
+		CHECK(str.length() == walk(str));
+
+		utf::utf16 copy {str};
+
+		copy.shrink_to_fit();
+
+		CHECK(copy.length() == walk(copy));
+		CHECK(copy.length() == str.length());
+	}
+
+	SUBCASE("random access")
+	{
+		const utf::utf32 str {U"abcdefghijklmnopqrstuvwxyz"};
+
+		static_assert(std::ranges::contiguous_range<decltype(str)>);
+		static_assert(std::ranges::sized_range<utf::str<utf::codec<"ASCII">>>);
+		static_assert(!std::ranges::sized_range<utf::utf8>);
+
+		CHECK(std::ranges::size(str) == 26);
+		CHECK(std::ranges::binary_search(str, U'q'));
+		CHECK(str.begin()[16] == U'q');
+		CHECK(str.rbegin()[16] == U'j');
+		CHECK(str.end() - str.begin() == 26);
+
+		const utf::utf8 src {u8"티라미수"};
+
+		auto it {src.end()};
+
+		it -= 3;
+
+		CHECK(*it == U'라');
+	}
+}
+
+TEST_CASE("searcher")
+{
+	utf::utf8 str {u8"티라미수☆치즈케잌☆말차라떼 🍰🍵 "
+	               u8"the quick brown fox jumps over the lazy dog; "
+	               u8"티라미수☆치즈케잌☆말차라떼 🍰🍵 "
+	               u8"the quick brown fox jumps over the lazy dog! "};
+
+	SUBCASE("short")
+	{
+		const utf::searcher<utf::codec<"UTF-8">> needle {u"☆"};
+
+		CHECK(needle.count(str) == 4);
+		CHECK(needle.find(str).value() == u8"☆");
+		CHECK(needle.split(str).size() == str.split(u8"☆").size());
+		CHECK(needle.match(str).size() == 4);
+	}
+
+	SUBCASE("long")
+	{
+		const utf::searcher<utf::codec<"UTF-8">> needle {U"the quick brown fox jumps over the lazy dog"};
+
+		CHECK(needle.count(str) == 2);
+		CHECK(!needle.find(u8"the quick brown fox").has_value());
+	}
+
+	SUBCASE("periodic")
+	{
+		const utf::searcher<utf::codec<"UTF-8">> needle {u8"abababababababababababababababababab"};
+
+		CHECK(needle.count(u8"ababababababababababababababababababababababababababababababababababababab") == 2);
+	}
+}
+
+TEST_CASE("multi_searcher")
+{
+	const utf::multi_searcher<utf::codec<"UTF-8">> needles {u"티라", U"미수", u8"라미"};
+
+	CHECK(needles.count(u8"티라미수") == 3);
+	CHECK(needles.count(u8"티라미수☆치즈케잌☆티라미수") == 6);
+	CHECK(needles.count(u8"치즈케잌") == 0);
+
+	std::vector<uint32_t> ids;
+
+	needles.scan(u8"티라미수", [&](uint32_t id, auto slice)
+	{
+		CHECK(slice.length() == 2); ids.push_back(id);
+	});
+
+	CHECK(ids == std::vector<uint32_t> {0, 2, 1});
+}
+
+TEST_CASE("validate")
+{
+	// long enough for every vector tier to walk past it
+	const std::u8string good {u8"the quick brown fox jumps over the lazy dog; "
+	                          u8"티라미수☆치즈케잌☆말차라떼 🍰🍵 "
+	                          u8"the quick brown fox jumps over the lazy dog! "
+	                          u8"티라미수☆치즈케잌☆말차라떼 🍰🍵 "};
+
+	const utf::txt<utf::codec<"UTF-8">> txt {good.data(), good.data() + good.size()};
+
+	SUBCASE("UTF-8")
+	{
+		const auto check {[&](const std::u8string& tail)
+		{
+			const auto str {good + tail};
+
+			return utf::validate(utf::txt<utf::codec<"UTF-8">> {str.data(), str.data() + str.size()});
+		}};
+
+		CHECK(check(u8"").has_value());
+
+		CHECK(check(u8"\xC0\xAF").error().kind == utf::error::OVERLONG);
+		CHECK(check(u8"\xE0\x80\xAF").error().kind == utf::error::OVERLONG);
+		CHECK(check(u8"\xED\xA0\x80").error().kind == utf::error::SURROGATE);
+		CHECK(check(u8"\xF4\x90\x80\x80").error().kind == utf::error::TOO_LARGE);
+		CHECK(check(u8"\xBF").error().kind == utf::error::TOO_LONG);
+		CHECK(check(u8"\xE2\x82").error().kind == utf::error::TOO_SHORT);
+		CHECK(check(u8"\xE2\x82!").error().kind == utf::error::TOO_SHORT);
+
+		CHECK(check(u8"\xE2\x82").error().offset == good.size());
+	}
+
+	SUBCASE("UTF-16")
+	{
+		utf::utf16 str {txt};
+
+		CHECK(utf::validate(str).has_value());
+
+		CHECK(utf::validate<utf::codec<"UTF-16">>(u"\xD800!").error().kind == utf::error::SURROGATE);
+		CHECK(utf::validate<utf::codec<"UTF-16">>(u"!\xDC00").error().offset == 1);
+	}
+
+	SUBCASE("from")
+	{
+		const auto str {utf::utf16::from(txt)};
+
+		REQUIRE(str.has_value());
+
+		CHECK(str.value() == utf::utf16 {txt});
+
+		CHECK(!utf::utf16::from(utf::txt<utf::codec<"UTF-32">> {U"\x110000"}).has_value());
 	}
 }
 
@@ -142,6 +627,15 @@ TEST_CASE("fileof")
 		CHECK(std::holds_alternative<utf::utf8>(file.value()));
 	}
 
+	SUBCASE("UTF-8 (strict)")
+	{
+		const auto file {utf::fileof("./tests/utf8.txt", utf::policy::STRICT)};
+
+		REQUIRE(file.has_value());
+
+		CHECK(std::holds_alternative<utf::utf8>(file.value()));
+	}
+
 	SUBCASE("UTF-16-LE")
 	{
 		const auto file {utf::fileof("./tests/utf16le.txt")};
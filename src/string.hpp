@@ -3,22 +3,38 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
+#include <cstdlib>
+#include <cstring>
 
 #include <bit>
 #include <ios>
 #include <tuple>
+#include <ranges>
 #include <memory>
 #include <vector>
+#include <compare>
 #include <variant>
 #include <utility>
 #include <ostream>
 #include <fstream>
+#include <expected>
 #include <iterator>
 #include <optional>
 #include <algorithm>
+#include <functional>
 #include <filesystem>
+#include <string_view>
 #include <type_traits>
 
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
 //┌────────────────────────────────────────────────────────────────────────────────┐
 //│         _          _            _            _          _             _        │
 //│        / /\       /\ \         /\ \         /\ \       /\ \     _    /\ \      │
@@ -88,6 +104,33 @@ std::type_identity<std::tuple_element_t<N, std::tuple<Args...>>>{ return {}; } (
 #define COPY_CONSTRUCTOR(T) constexpr T(const T& other) noexcept
 #define MOVE_CONSTRUCTOR(T) constexpr T(T&& other) noexcept
 
+//┌──────────────────────────────────────────────────────────────┐
+//│ SIMD kernels are x86-64 only, and are compiled per tier via  │
+//│ target attributes, so that no -march flag is ever required.  │
+//│                                                              │
+//│ every other arch (or constant evaluation) takes scalar path. │
+//│                                                              │
+//│ the tier is picked at run time from cpuid, once per process, │
+//│ and can be capped to SCALAR, SSE42, AVX2 or AVX512 with      │
+//│ -DUTF_SIMD=<tier> or the UTF_SIMD=<tier> environment var.    │
+//└──────────────────────────────────────────────────────────────┘
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define X86_64 1
+#else
+#define X86_64 0
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#define TARGET(isa) /* MSVC; intrinsics are always available */
+#else
+#define TARGET(isa) __attribute__((target(TARGET_##isa)))
+#endif
+
+#define TARGET_SSE42 "sse4.2,popcnt"
+#define TARGET_AVX2 "avx2,bmi,bmi2,popcnt,lzcnt"
+#define TARGET_AVX512 "avx512f,avx512bw,avx512vl,avx2,bmi,bmi2,popcnt,lzcnt"
+
 //┌───────┬───────┬────────────┬─────────────────┐
 //│ class │ owns? │ null-term? │ use-after-free? │
 //├───────┼───────┼────────────┼─────────────────┤
@@ -98,6 +141,10 @@ std::type_identity<std::tuple_element_t<N, std::tuple<Args...>>>{ return {}; } (
 
 /* owns str */ template <typename Codec, typename Alloc = std::allocator<typename Codec::T>> class str;
 /* str view */ template <typename Codec /* slice is a not-owning view of ptr<const unit> */> class txt;
+/* searcher */ template <typename Codec /* a needle, preprocessed once for many haystacks */> class searcher;
+/* searcher */ template <typename Codec /* many needles, matched all at once in one pass */> class multi_searcher;
+/* lazy one */ template <typename Codec /* pieces between matches, searched on demand */, typename Needle = searcher<Codec>> class split_view;
+/* lazy one */ template <typename Codec /* matches themselves, searched on demand */, typename Needle = searcher<Codec>> class match_view;
 
 #define __OWNED__(name) const str<Other, Arena>& name
 #define __SLICE__(name) const txt<Other /*##*/>  name
@@ -120,6 +167,58 @@ inline constexpr auto operator-
 (range, size_t offset) noexcept
 -> clamp { return { offset }; }
 
+// error-as-value; where, and why a string is ill-formed.
+struct error
+{
+	enum kind_t : uint8_t
+	{
+		TOO_SHORT, // a sequence ends before its last code unit
+		TOO_LONG,  // a continuation byte follows no lead byte
+		OVERLONG,  // a code point is encoded in more bytes than needed
+		TOO_LARGE, // a code point is past U+10FFFF (U+007F for ASCII)
+		SURROGATE, // a surrogate is encoded as is, or left unpaired
+	};
+
+	size_t offset; // in code units, to the start of the sequence
+	kind_t kind;
+};
+
+// how far fileof trusts the content of a file.
+enum class policy : uint8_t
+{
+	TRUST,  // as is; the caller vouches for it
+	STRICT, // validated; std::nullopt if ill-formed
+};
+
+// what find and co. count, besides the code unit offset.
+enum class index : uint8_t
+{
+	UNIT, // code units alone; free
+	CODE, // code points too; a walk from the head
+};
+
+// what transform may assume of its mapping.
+enum class ascii : uint8_t
+{
+	MAP,  // every code point goes through it
+	KEEP, // ASCII maps to itself; runs of it are copied as is
+};
+
+// how a str grows its buffer, per allocator; specialize it to plug in another factor.
+template <typename Alloc> struct growth
+{
+	// num / den times the capacity, or what is asked for, whichever is more
+	static constexpr const size_t num {2};
+	static constexpr const size_t den {1};
+};
+
+// where a match starts; in code units, and in code points if asked for.
+struct offset
+{
+	size_t unit;
+	std::optional<size_t> code;
+};
+
 template <label> struct codec
 {
 	static_assert(false, "?");
@@ -212,6 +311,16 @@ template <> struct codec<"UTF-32">
 template <typename Class /* CRTP core */> class API
 {
 	template <typename> friend class API;
+	template <typename> friend class searcher;
+	template <typename> friend class multi_searcher;
+	template <typename, typename> friend class split_view;
+	template <typename, typename> friend class match_view;
+
+	template <typename Other, typename Arena> friend auto operator<<(std::ostream& os, __OWNED__(str)) noexcept -> decltype(os);
+	template <typename Other /* can't own */> friend auto operator<<(std::ostream& os, __SLICE__(str)) noexcept -> decltype(os);
+
+	template <typename Other, typename Arena> friend constexpr auto validate(__OWNED__(str)) noexcept -> std::expected<void, error>;
+	template <typename Other /* can't own */> friend constexpr auto validate(__SLICE__(str)) noexcept -> std::expected<void, error>;
 
 	   using Codec = get_arg_t<Class, 0>;
 	// using Alloc = get_arg_t<Class, 1>;
@@ -280,6 +389,20 @@ public:
 	template <size_t                       N>
 	constexpr auto contains(__32STR__(value)) const noexcept -> size_t /* encoding of char32_t is trivial */;
 
+	// *self explanatory* returns whether or not it includes *parameter*; stops at the 1st match.
+	template <typename Other, typename Arena>
+	constexpr auto includes(__OWNED__(value)) const noexcept -> bool;
+	template <typename Other /* can't own */>
+	constexpr auto includes(__SLICE__(value)) const noexcept -> bool;
+	template <size_t                       N>
+	constexpr auto includes(__EQSTR__(value)) const noexcept -> bool requires (std::is_same_v<T, char>);
+	template <size_t                       N>
+	constexpr auto includes(__08STR__(value)) const noexcept -> bool /* encoding of char8_t is trivial */;
+	template <size_t                       N>
+	constexpr auto includes(__16STR__(value)) const noexcept -> bool /* encoding of char16_t is trivial */;
+	template <size_t                       N>
+	constexpr auto includes(__32STR__(value)) const noexcept -> bool /* encoding of char32_t is trivial */;
+
 	// returns a list of string slice, of which is a product of split aka division.
 	template <typename Other, typename Arena>
 	constexpr auto split(__OWNED__(value)) const noexcept -> std::vector<txt<Codec>>;
@@ -308,6 +431,98 @@ public:
 	template <size_t                       N>
 	constexpr auto match(__32STR__(value)) const noexcept -> std::vector<txt<Codec>> /* encoding of char32_t is trivial */;
 
+	// returns a lazy range of string slice, of which is a product of split aka division.
+	template <typename Other, typename Arena>
+	constexpr auto split_view(__OWNED__(value)) const noexcept -> utf::split_view<Codec>;
+	template <typename Other /* can't own */>
+	constexpr auto split_view(__SLICE__(value)) const noexcept -> utf::split_view<Codec>;
+	template <size_t                       N>
+	constexpr auto split_view(__EQSTR__(value)) const noexcept -> utf::split_view<Codec> requires (std::is_same_v<T, char>);
+	template <size_t                       N>
+	constexpr auto split_view(__08STR__(value)) const noexcept -> utf::split_view<Codec> /* encoding of char8_t is trivial */;
+	template <size_t                       N>
+	constexpr auto split_view(__16STR__(value)) const noexcept -> utf::split_view<Codec> /* encoding of char16_t is trivial */;
+	template <size_t                       N>
+	constexpr auto split_view(__32STR__(value)) const noexcept -> utf::split_view<Codec> /* encoding of char32_t is trivial */;
+	// same, but refers to a prepared needle, which must outlive the range.
+	constexpr auto split_view(const searcher<Codec>& value) const noexcept -> utf::split_view<Codec, std::reference_wrapper<const searcher<Codec>>>;
+
+	// returns a lazy range of string slice, of which is a product of search occurrence.
+	template <typename Other, typename Arena>
+	constexpr auto match_view(__OWNED__(value)) const noexcept -> utf::match_view<Codec>;
+	template <typename Other /* can't own */>
+	constexpr auto match_view(__SLICE__(value)) const noexcept -> utf::match_view<Codec>;
+	template <size_t                       N>
+	constexpr auto match_view(__EQSTR__(value)) const noexcept -> utf::match_view<Codec> requires (std::is_same_v<T, char>);
+	template <size_t                       N>
+	constexpr auto match_view(__08STR__(value)) const noexcept -> utf::match_view<Codec> /* encoding of char8_t is trivial */;
+	template <size_t                       N>
+	constexpr auto match_view(__16STR__(value)) const noexcept -> utf::match_view<Codec> /* encoding of char16_t is trivial */;
+	template <size_t                       N>
+	constexpr auto match_view(__32STR__(value)) const noexcept -> utf::match_view<Codec> /* encoding of char32_t is trivial */;
+	// same, but refers to a prepared needle, which must outlive the range.
+	constexpr auto match_view(const searcher<Codec>& value) const noexcept -> utf::match_view<Codec, std::reference_wrapper<const searcher<Codec>>>;
+
+	// returns where the 1st match starts, if any.
+	template <typename Other, typename Arena>
+	constexpr auto find(__OWNED__(value), index mode = index::UNIT) const noexcept -> std::optional<offset>;
+	template <typename Other /* can't own */>
+	constexpr auto find(__SLICE__(value), index mode = index::UNIT) const noexcept -> std::optional<offset>;
+	template <size_t                       N>
+	constexpr auto find(__EQSTR__(value), index mode = index::UNIT) const noexcept -> std::optional<offset> requires (std::is_same_v<T, char>);
+	template <size_t                       N>
+	constexpr auto find(__08STR__(value), index mode = index::UNIT) const noexcept -> std::optional<offset> /* encoding of char8_t is trivial */;
+	template <size_t                       N>
+	constexpr auto find(__16STR__(value), index mode = index::UNIT) const noexcept -> std::optional<offset> /* encoding of char16_t is trivial */;
+	template <size_t                       N>
+	constexpr auto find(__32STR__(value), index mode = index::UNIT) const noexcept -> std::optional<offset> /* encoding of char32_t is trivial */;
+
+	// returns where the last match starts, if any; overlaps included, searched from the tail.
+	template <typename Other, typename Arena>
+	constexpr auto rfind(__OWNED__(value), index mode = index::UNIT) const noexcept -> std::optional<offset>;
+	template <typename Other /* can't own */>
+	constexpr auto rfind(__SLICE__(value), index mode = index::UNIT) const noexcept -> std::optional<offset>;
+	template <size_t                       N>
+	constexpr auto rfind(__EQSTR__(value), index mode = index::UNIT) const noexcept -> std::optional<offset> requires (std::is_same_v<T, char>);
+	template <size_t                       N>
+	constexpr auto rfind(__08STR__(value), index mode = index::UNIT) const noexcept -> std::optional<offset> /* encoding of char8_t is trivial */;
+	template <size_t                       N>
+	constexpr auto rfind(__16STR__(value), index mode = index::UNIT) const noexcept -> std::optional<offset> /* encoding of char16_t is trivial */;
+	template <size_t                       N>
+	constexpr auto rfind(__32STR__(value), index mode = index::UNIT) const noexcept -> std::optional<offset> /* encoding of char32_t is trivial */;
+
+	// returns where the nth (0-based) distinct match starts, if any.
+	template <typename Other, typename Arena>
+	constexpr auto find_nth(__OWNED__(value), size_t nth, index mode = index::UNIT) const noexcept -> std::optional<offset>;
+	template <typename Other /* can't own */>
+	constexpr auto find_nth(__SLICE__(value), size_t nth, index mode = index::UNIT) const noexcept -> std::optional<offset>;
+	template <size_t                       N>
+	constexpr auto find_nth(__EQSTR__(value), size_t nth, index mode = index::UNIT) const noexcept -> std::optional<offset> requires (std::is_same_v<T, char>);
+	template <size_t                       N>
+	constexpr auto find_nth(__08STR__(value), size_t nth, index mode = index::UNIT) const noexcept -> std::optional<offset> /* encoding of char8_t is trivial */;
+	template <size_t                       N>
+	constexpr auto find_nth(__16STR__(value), size_t nth, index mode = index::UNIT) const noexcept -> std::optional<offset> /* encoding of char16_t is trivial */;
+	template <size_t                       N>
+	constexpr auto find_nth(__32STR__(value), size_t nth, index mode = index::UNIT) const noexcept -> std::optional<offset> /* encoding of char32_t is trivial */;
+
+	// appends where every distinct match starts to *out*; returns how many.
+	template <typename Other, typename Arena>
+	constexpr auto find_all_into(__OWNED__(value), std::vector<offset>& out, index mode = index::UNIT) const noexcept -> size_t;
+	template <typename Other /* can't own */>
+	constexpr auto find_all_into(__SLICE__(value), std::vector<offset>& out, index mode = index::UNIT) const noexcept -> size_t;
+	template <size_t                       N>
+	constexpr auto find_all_into(__EQSTR__(value), std::vector<offset>& out, index mode = index::UNIT) const noexcept -> size_t requires (std::is_same_v<T, char>);
+	template <size_t                       N>
+	constexpr auto find_all_into(__08STR__(value), std::vector<offset>& out, index mode = index::UNIT) const noexcept -> size_t /* encoding of char8_t is trivial */;
+	template <size_t                       N>
+	constexpr auto find_all_into(__16STR__(value), std::vector<offset>& out, index mode = index::UNIT) const noexcept -> size_t /* encoding of char16_t is trivial */;
+	template <size_t                       N>
+	constexpr auto find_all_into(__32STR__(value), std::vector<offset>& out, index mode = index::UNIT) const noexcept -> size_t /* encoding of char32_t is trivial */;
+
+	// overwrites *dest* with fun(code) for every code point, in one pass; fun returns a code point, or a string.
+	template <typename Other, typename Arena, typename Fun> requires (std::is_invocable_v<const Fun&, char32_t>)
+	constexpr auto transform_into(str<Other, Arena>& dest, const Fun& fun, ascii mode = ascii::MAP) const noexcept -> void;
+
 	// returns a slice, of which is a product of substring. N is a sentinel value.
 	constexpr auto substr(clamp  start, clamp  until) const noexcept -> txt<Codec>;
 	constexpr auto substr(clamp  start, range  until) const noexcept -> txt<Codec>;
@@ -423,16 +638,77 @@ public:
 		return {{lhs}, {rhs}};
 	}
 
+	// donor operators; an rvalue str lends its buffer, so the chain appends in place
+
+	template <typename Other, typename Arena>
+	friend constexpr auto operator+(Class&& lhs, __OWNED__(rhs)) noexcept -> concat<Class&&, txt<Other>> requires (!std::is_same_v<Class, txt<Codec>>)
+	{
+		return {std::move(lhs), {rhs}};
+	}
+
+	template <typename Other /* can't own */>
+	friend constexpr auto operator+(Class&& lhs, __SLICE__(rhs)) noexcept -> concat<Class&&, txt<Other>> requires (!std::is_same_v<Class, txt<Codec>>)
+	{
+		return {std::move(lhs), {rhs}};
+	}
+
+	template <size_t                       N>
+	friend constexpr auto operator+(Class&& lhs, __EQSTR__(rhs)) noexcept -> concat<Class&&, txt<Codec>> requires (!std::is_same_v<Class, txt<Codec>> && std::is_same_v<T, char>)
+	{
+		return {std::move(lhs), {&rhs[N - N], &rhs[N - 1]}};
+	}
+
+	template <size_t                       N>
+	friend constexpr auto operator+(Class&& lhs, __08STR__(rhs)) noexcept -> concat<Class&&, txt<codec<"UTF-8">>> requires (!std::is_same_v<Class, txt<Codec>>)
+	{
+		return {std::move(lhs), {&rhs[N - N], &rhs[N - 1]}};
+	}
+
+	template <size_t                       N>
+	friend constexpr auto operator+(Class&& lhs, __16STR__(rhs)) noexcept -> concat<Class&&, txt<codec<"UTF-16">>> requires (!std::is_same_v<Class, txt<Codec>>)
+	{
+		return {std::move(lhs), {&rhs[N - N], &rhs[N - 1]}};
+	}
+
+	template <size_t                       N>
+	friend constexpr auto operator+(Class&& lhs, __32STR__(rhs)) noexcept -> concat<Class&&, txt<codec<"UTF-32">>> requires (!std::is_same_v<Class, txt<Codec>>)
+	{
+		return {std::move(lhs), {&rhs[N - N], &rhs[N - 1]}};
+	}
+
 private:
 
 	template <typename LHS, typename RHS> class concat
 	{
+		template <typename,typename> friend class str;
+		template <typename,typename> friend class concat;
+
 		using blank_t = txt<codec<"ASCII">>;
 
+		// LHS may be 'str&&'; a donor that lends its buffer
 		const LHS lhs;
 		const RHS rhs;
 		
-		constexpr auto __for_each__(const auto&& fun) const noexcept -> void;
+		constexpr auto __for_each__(const auto& fun) const noexcept -> void;
+
+		// returns ptr to the leftmost chunk if it's a donor, nullptr otherwise.
+		constexpr auto __donor__() const noexcept -> auto;
+
+		// whether any chunk but 'skip' views the buffer of 'dest'.
+		template <typename Other, typename Arena>
+		constexpr auto __alias__(const str<Other, Arena>& dest, const void* skip) const noexcept -> bool;
+
+		// appends every chunk to 'dest'; grows once, transcodes once.
+		template <typename Other, typename Arena>
+		constexpr auto __append__(/*&*/ str<Other, Arena>& dest) const noexcept -> void;
+
+		// str::operator=
+		template <typename Other, typename Arena>
+		constexpr auto __assign__(/*&*/ str<Other, Arena>& dest) const noexcept -> void;
+
+		// str::operator+=
+		template <typename Other, typename Arena>
+		constexpr auto __concat__(/*&*/ str<Other, Arena>& dest) const noexcept -> void;
 
 	public:
 
@@ -441,8 +717,17 @@ private:
 			decltype(lhs) lhs,
 			decltype(rhs) rhs
 		)
-		noexcept : lhs {lhs},
-		           rhs {rhs}
+		noexcept : lhs {std::forward<decltype(lhs)>(lhs)},
+		           rhs {/*#################*/ rhs}
+		{}
+
+		// fix; 'str&&' member deletes the implicit one
+		constexpr concat
+		(
+			const concat& other
+		)
+		noexcept : lhs {std::forward<decltype(lhs)>(other.lhs)},
+		           rhs {/*#################*/ other.rhs}
 		{}
 
 		template <typename Other, typename Arena>
@@ -481,17 +766,22 @@ private:
 		constexpr auto operator+(__32STR__(rhs)) noexcept -> concat<concat, txt<codec<"UTF-32">>>;
 	};
 
+	// a code point is a code unit; O(1) jumps
+	static constexpr const bool FIXED {!Codec::is_variable && !Codec::is_stateful};
+	// a code point is a code unit, as is; no decoding
+	static constexpr const bool SOLID {FIXED && std::is_same_v<T, char32_t>};
+
 	class const_forward_iterator
 	{
 		const T* ptr;
 
 	public:
 
-		using iterator_category = std::bidirectional_iterator_tag;
-		using iterator_concept = std::bidirectional_iterator_tag;
+		using iterator_category = std::conditional_t<FIXED, std::random_access_iterator_tag, std::bidirectional_iterator_tag>;
+		using iterator_concept = std::conditional_t<SOLID, std::contiguous_iterator_tag, iterator_category>;
 		using difference_type = std::ptrdiff_t;
 		using value_type = char32_t;
-		using reference = char32_t;
+		using reference = std::conditional_t<SOLID, const char32_t&, char32_t>;
 
 		constexpr const_forward_iterator
 		(
@@ -504,7 +794,9 @@ private:
 		constexpr  const_forward_iterator() noexcept = default;
 		constexpr ~const_forward_iterator() noexcept = default;
 
-		constexpr auto operator*() const noexcept -> value_type;
+		constexpr auto operator*() const noexcept -> reference;
+		constexpr auto operator->() const noexcept -> const T* requires (SOLID);
+		constexpr auto operator[](difference_type value) const noexcept -> reference requires (FIXED);
 
 		constexpr auto operator++(   ) noexcept -> const_forward_iterator&;
 		constexpr auto operator++(int) noexcept -> const_forward_iterator;
@@ -512,14 +804,23 @@ private:
 		constexpr auto operator--(   ) noexcept -> const_forward_iterator&;
 		constexpr auto operator--(int) noexcept -> const_forward_iterator;
 
-		constexpr auto operator+(size_t value) noexcept -> const_forward_iterator;
-		constexpr auto operator-(size_t value) noexcept -> const_forward_iterator;
+		constexpr auto operator+(difference_type value) const noexcept -> const_forward_iterator;
+		constexpr auto operator-(difference_type value) const noexcept -> const_forward_iterator;
+
+		constexpr auto operator+=(difference_type value) noexcept -> const_forward_iterator&;
+		constexpr auto operator-=(difference_type value) noexcept -> const_forward_iterator&;
 
-		constexpr auto operator+=(size_t value) noexcept -> const_forward_iterator&;
-		constexpr auto operator-=(size_t value) noexcept -> const_forward_iterator&;
+		constexpr auto operator-(const const_forward_iterator& rhs) const noexcept -> difference_type requires (FIXED);
 
 		constexpr auto operator==(const const_forward_iterator& rhs) const noexcept -> bool = default;
 		constexpr auto operator!=(const const_forward_iterator& rhs) const noexcept -> bool = default;
+
+		constexpr auto operator<=>(const const_forward_iterator& rhs) const noexcept -> std::strong_ordering requires (FIXED);
+
+		friend constexpr auto operator+(difference_type lhs, const const_forward_iterator& rhs) noexcept -> const_forward_iterator requires (FIXED)
+		{
+			return rhs + lhs;
+		}
 	};
 
 	class const_reverse_iterator
@@ -528,8 +829,8 @@ private:
 
 	public:
 
-		using iterator_category = std::bidirectional_iterator_tag;
-		using iterator_concept = std::bidirectional_iterator_tag;
+		using iterator_category = std::conditional_t<FIXED, std::random_access_iterator_tag, std::bidirectional_iterator_tag>;
+		using iterator_concept = std::conditional_t<FIXED, std::random_access_iterator_tag, std::bidirectional_iterator_tag>;
 		using difference_type = std::ptrdiff_t;
 		using value_type = char32_t;
 		using reference = char32_t;
@@ -546,6 +847,7 @@ private:
 		constexpr ~const_reverse_iterator() noexcept = default;
 
 		constexpr auto operator*() const noexcept -> value_type;
+		constexpr auto operator[](difference_type value) const noexcept -> value_type requires (FIXED);
 
 		constexpr auto operator++(   ) noexcept -> const_reverse_iterator&;
 		constexpr auto operator++(int) noexcept -> const_reverse_iterator;
@@ -553,14 +855,23 @@ private:
 		constexpr auto operator--(   ) noexcept -> const_reverse_iterator&;
 		constexpr auto operator--(int) noexcept -> const_reverse_iterator;
 
-		constexpr auto operator+(size_t value) noexcept -> const_reverse_iterator;
-		constexpr auto operator-(size_t value) noexcept -> const_reverse_iterator;
+		constexpr auto operator+(difference_type value) const noexcept -> const_reverse_iterator;
+		constexpr auto operator-(difference_type value) const noexcept -> const_reverse_iterator;
 
-		constexpr auto operator+=(size_t value) noexcept -> const_reverse_iterator&;
-		constexpr auto operator-=(size_t value) noexcept -> const_reverse_iterator&;
+		constexpr auto operator+=(difference_type value) noexcept -> const_reverse_iterator&;
+		constexpr auto operator-=(difference_type value) noexcept -> const_reverse_iterator&;
+
+		constexpr auto operator-(const const_reverse_iterator& rhs) const noexcept -> difference_type requires (FIXED);
 
 		constexpr auto operator==(const const_reverse_iterator& rhs) const noexcept -> bool = default;
 		constexpr auto operator!=(const const_reverse_iterator& rhs) const noexcept -> bool = default;
+
+		constexpr auto operator<=>(const const_reverse_iterator& rhs) const noexcept -> std::strong_ordering requires (FIXED);
+
+		friend constexpr auto operator+(difference_type lhs, const const_reverse_iterator& rhs) noexcept -> const_reverse_iterator requires (FIXED)
+		{
+			return rhs + lhs;
+		}
 	};
 };
 
@@ -652,10 +963,75 @@ template <typename Codec, typename Alloc> class str : public API<str<Codec, Allo
 	// fixes invariant; use it after internal manipulation.
 	constexpr auto __size__(size_t value) noexcept -> void;
 
+	//┌──────┬──────────────────────┐
+	//│ slot │ units... │ NUL │     │
+	//└──────┴──────────────────────┘
+	//  ↑ large mode, run time only, variable width only; a ptr to what is worth remembering about the content
+
+	struct meta
+	{
+		using crumbs_t = std::vector<size_t, typename allocator::template rebind_alloc<size_t>>;
+
+		// unit offset of every STEP-th code point; [0] is 0 once built
+		crumbs_t crumbs;
+		// number of code points, if known; see COUNT
+		std::optional<size_t> length;
+	};
+
+	// same allocator as the buffer, rebound
+	using meta_allocator = typename allocator::template rebind_traits<meta>;
+
+	// code points between two breadcrumbs
+	static constexpr const size_t STEP {128};
+
+	// whether a large buffer has a slot; fixed width seeks and counts in O(1) anyway
+	static constexpr const bool SLOT {Codec::is_variable || Codec::is_stateful};
+
+	// whether a large buffer keeps count of its code points; -DUTF_LENGTH to opt in
+	#ifdef UTF_LENGTH
+	static constexpr const bool COUNT {SLOT};
+	#else
+	static constexpr const bool COUNT {false};
+	#endif
+
+	// returns the number of code units in front of a large buffer; none at compile time.
+	static constexpr auto __slot__() noexcept -> size_t;
+
+	// returns the side index of a large buffer, if built.
+	constexpr auto __meta__() const noexcept -> meta*;
+	// replaces the side index of a large buffer.
+	constexpr auto __meta__(meta* value) /*&*/ noexcept -> void;
+
+	// returns the side index of a large buffer, building an empty one if none.
+	constexpr auto __attach__() /*&*/ noexcept -> meta*;
+	// frees a side index with the given allocator; nullptr is a no-op.
+	static constexpr auto __detach__(Alloc& alloc, meta* side) noexcept -> void;
+
+	// drops the breadcrumbs past code unit 'from'; the content there has changed.
+	constexpr auto __stale__(size_t from) noexcept -> void;
+	// moves the breadcrumbs past code unit 'from' by 'delta' code units.
+	constexpr auto __shift__(size_t from, ptrdiff_t delta) noexcept -> void;
+
+	// returns the cached code point count of a large buffer, if known.
+	constexpr auto __length__() const noexcept -> std::optional<size_t>;
+	// caches the code point count of a large buffer, if worth it; forgets it otherwise.
+	constexpr auto __length__(std::optional<size_t> value) /*&*/ noexcept -> void;
+	// caches the code point count, given 'prev' code points in the first 'from' code units.
+	constexpr auto __recount__(std::optional<size_t> prev, size_t from) /*&*/ noexcept -> void;
+
+	// returns ptr to the nth code point, or the tail; O(STEP) once indexed. never touches the index.
+	constexpr auto __seek__(size_t nth) const noexcept -> const T*;
+	// returns ptr to the nth code point, or the tail; O(STEP) once indexed. extends the index as needed.
+	constexpr auto __seek__(size_t nth) /*&*/ noexcept -> const T*;
+
+	// extends the side index of a large buffer as far as the nth code point.
+	constexpr auto __index__(size_t nth) noexcept -> void;
+
 	storage store;
 
 	class reader; friend reader;
 	class writer; friend writer;
+	class editor; friend editor;
 
 	class forward_iterator; friend forward_iterator;
 	class reverse_iterator; friend reverse_iterator;
@@ -678,13 +1054,20 @@ template <typename Codec, typename Alloc> class str : public API<str<Codec, Allo
 	template <typename Other>
 	constexpr auto __concat__(const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> __concat__t;
 
-	// 2x capacity growth
+	// amortized capacity growth
 	[[nodiscard("code smell")]] constexpr auto __insert__(T* dest, char32_t code, int8_t step) noexcept -> __insert__t;
 
+	// gives back what a worst case bound left unused, past what growth would keep anyway.
+	constexpr auto __trim__() noexcept -> void;
+
+	// replaces the first 'n' distinct matches of [rhs_0, rhs_N) with [val_0, val_N); in place if it fits, else one allocation.
+	template <typename Other>
+	constexpr auto __replace__(const typename Other::T* rhs_0, const typename Other::T* rhs_N, const T* val_0, const T* val_N, size_t n) noexcept -> size_t;
+
 public:
 
 	// optional; returns the content of a file with CRLF/CR to LF normalization.
-	template <typename STRING> friend auto fileof(const STRING& path) noexcept
+	template <typename STRING> friend auto fileof(const STRING& path, policy mode) noexcept
 	->
 	std::optional<std::variant
 	<
@@ -724,10 +1107,36 @@ public:
 	template <size_t                       N>
 	constexpr str(__32STR__(str)) noexcept /* encoding of char32_t is trivial */;
 
+	// error-as-value; validates *parameter* before it enters the string.
+	template <typename Other, typename Arena>
+	static constexpr auto from(__OWNED__(text)) noexcept -> std::expected<str, error>;
+	template <typename Other /* can't own */>
+	static constexpr auto from(__SLICE__(text)) noexcept -> std::expected<str, error>;
+
+	// replaces every code point with fun(code), in one pass; fun returns a code point, or a string.
+	template <typename Fun> requires (std::is_invocable_v<const Fun&, char32_t>)
+	constexpr auto transform(const Fun& fun, ascii mode = ascii::MAP) /*&*/ noexcept -> str&;
+
+	// replaces every distinct match of *needle* with *value*, in one pass; returns how many.
+	template <typename Needle, typename Value> requires requires (const Needle& rhs, const Value& val) { txt {rhs}; str {val}; }
+	constexpr auto replace_all(const Needle& needle, const Value& value) /*&*/ noexcept -> size_t;
+	// replaces the first *n* distinct matches of *needle* with *value*, in one pass; returns how many.
+	template <typename Needle, typename Value> requires requires (const Needle& rhs, const Value& val) { txt {rhs}; str {val}; }
+	constexpr auto replace_n(const Needle& needle, const Value& value, size_t n) /*&*/ noexcept -> size_t;
+
+	// batches positional edits, in code points of the string as is; applied in one pass, on commit.
+	constexpr auto edit(/* batch */) /*&*/ noexcept -> editor;
+
 	// returns the number of code units it can hold, excluding NULL-TERMINATOR.
 	constexpr auto capacity(/* getter */) const noexcept -> size_t;
-	// changes the number of code units it can hold, excluding NULL-TERMINATOR.
+	// changes the number of code units it can hold, excluding NULL-TERMINATOR; exactly, and never below it.
 	constexpr auto capacity(size_t value) /*&*/ noexcept -> void;
+	// makes room for at least *value* code units, excluding NULL-TERMINATOR; grows by growth<Alloc>.
+	constexpr auto reserve(size_t value) /*&*/ noexcept -> void;
+	// releases the unused capacity; back to SSO, if short enough.
+	constexpr auto shrink_to_fit(/* exact */) /*&*/ noexcept -> void;
+	// builds the side index in full; const reads, i.e. from many threads, then jump by it.
+	constexpr auto build_index(/* eager */) /*&*/ noexcept -> void;
 
 	// iterator
 
@@ -797,6 +1206,18 @@ public:
 	template <size_t                       N>
 	constexpr auto operator+=(__32STR__(rhs))&& noexcept -> str&& /* encoding of char32_t is trivial */;
 
+	// lazy concat; writes its chunks straight into the buffer, growing it once
+	template <typename Chain> requires requires (const Chain& rhs, str& self) { rhs.__assign__(self); }
+	constexpr auto operator=(const Chain& rhs)& noexcept -> str&;
+	template <typename Chain> requires requires (const Chain& rhs, str& self) { rhs.__assign__(self); }
+	constexpr auto operator=(const Chain& rhs)&& noexcept -> str&&;
+
+	// lazy concat; writes its chunks straight into the buffer, growing it once
+	template <typename Chain> requires requires (const Chain& rhs, str& self) { rhs.__concat__(self); }
+	constexpr auto operator+=(const Chain& rhs)& noexcept -> str&;
+	template <typename Chain> requires requires (const Chain& rhs, str& self) { rhs.__concat__(self); }
+	constexpr auto operator+=(const Chain& rhs)&& noexcept -> str&&;
+
 private:
 
 	class reader
@@ -845,6 +1266,36 @@ private:
 		constexpr auto operator!=(char32_t code) const noexcept -> bool;
 	};
 
+	class editor
+	{
+		// [from, until) code points give way to pool[head, tail)
+		struct splice { size_t from; size_t until; size_t head; size_t tail; };
+
+		/*&*/ str* src;
+		std::vector<splice> edits;
+		std::vector<T> pool;
+
+	public:
+
+		constexpr editor
+		(
+			decltype(src) src
+		)
+		noexcept : src {src}
+		{}
+
+		// replaces the nth code point with *code*; past the end, it does nothing.
+		constexpr auto replace(size_t nth, char32_t code) noexcept -> editor&;
+		// inserts *value* in front of the nth code point; past the end, it appends.
+		template <typename Value> requires requires (const Value& val) { str {val}; }
+		constexpr auto insert(size_t nth, const Value& value) noexcept -> editor&;
+		// erases *n* code points from the nth onwards; past the end, it does nothing.
+		constexpr auto erase(size_t nth, size_t n) noexcept -> editor&;
+
+		// applies every edit in one pass, then forgets them; an edit on a code point already taken is dropped.
+		constexpr auto commit() noexcept -> str&;
+	};
+
 	// self-healing iterator; allows mutation
 	template <typename Iterator> class cursor
 	{
@@ -884,75 +1335,63 @@ private:
 		//
 		// in order to enable stl, iterator pair must be of the same type.
 		// on top of that, each end's behaviour must differ, and copy-safe.
+		//
+		// copies never share state; the anchor (head or tail) is read from
+		// 'src' on every access instead, which heals after any reallocation
+		// or buffer shift without a heap allocation or a refcount.
 
-		struct state : std::enable_shared_from_this<state>
+		class proxy
 		{
-			/*&&&*/ S* src;
-			mutable T* ptr;
+			S*                     src;
+			T*                     needle;
+			it_cursor_category_tag cursor_tag;
 
-			constexpr state
+		public:
+
+			constexpr proxy
 			(
 				decltype(src) src,
-				decltype(ptr) ptr
+				decltype(needle) needle,
+				decltype(cursor_tag) cursor_tag
 			)
 			noexcept : src {src},
-			           ptr {ptr}
+			           needle {needle},
+			           cursor_tag {cursor_tag}
 			{}
 
-			class proxy
-			{
-				std::shared_ptr<state> common;
-				T*                     needle;
-				it_offset_relative_tag offset_tag;
-				it_cursor_category_tag cursor_tag;
-
-			public:
-
-				constexpr proxy
-				(
-					decltype(common) common,
-					decltype(needle) needle,
-					decltype(offset_tag) offset_tag,
-					decltype(cursor_tag) cursor_tag
-				)
-				noexcept : common {common},
-				           needle {needle},
-				           offset_tag {offset_tag},
-				           cursor_tag {cursor_tag}
-				{}
-
-				[[nodiscard]] constexpr operator char32_t() const noexcept;
-				constexpr auto operator=(char32_t code) noexcept -> proxy&;
-
-				constexpr auto operator==(char32_t code) const noexcept -> bool;
-				constexpr auto operator!=(char32_t code) const noexcept -> bool;
-			};
+			[[nodiscard]] constexpr operator char32_t() const noexcept;
+			constexpr auto operator=(char32_t code) noexcept -> proxy&;
+
+			constexpr auto operator==(char32_t code) const noexcept -> bool;
+			constexpr auto operator!=(char32_t code) const noexcept -> bool;
 		};
 
-		std::shared_ptr<state> common;
+		S*                     src;
 		size_t                 offset;
 		size_t                 weight;
 		it_offset_relative_tag offset_tag;
 		it_cursor_category_tag cursor_tag;
 
+		// returns ptr to the code unit the cursor points at.
+		constexpr auto __needle__() const noexcept -> T*;
+
 	public:
 
 		using iterator_category = std::bidirectional_iterator_tag;
 		using iterator_concept = std::bidirectional_iterator_tag;
 		using difference_type = std::ptrdiff_t;
-		using value_type = typename state::proxy;
-		using reference = typename state::proxy;
+		using value_type = proxy;
+		using reference = proxy;
 
 		constexpr cursor
 		(
-			S* src,
-			T* ptr,
+			decltype(src) src,
 			decltype(offset) offset,
 			decltype(weight) weight,
 			decltype(offset_tag) offset_tag,
 			decltype(cursor_tag) cursor_tag
 		)
-		noexcept : common {std::make_shared<state>(src, ptr)},
+		noexcept : src {src},
 		           offset {offset},
 		           weight {weight},
 		           offset_tag {offset_tag},
@@ -1046,6 +1485,9 @@ public:
 	           __tail__ {str.__tail__()}
 	{}
 
+	// error-as-value; validates [head, tail) before it enters the view.
+	static constexpr auto from(decltype(__head__) head, decltype(__tail__) tail) noexcept -> std::expected<txt, error>;
+
 	COPY_CONSTRUCTOR(txt) = default;
 	MOVE_CONSTRUCTOR(txt) = default;
 
@@ -1104,71 +1546,379 @@ private:
 	};
 };
 
-namespace detail
+//┌──────────────────────────────────────────────────────────────┐
+//│ one needle, many haystacks; the needle is transcoded into    │
+//│ the haystack's codec and preprocessed once, at construction, │
+//│ so that find, count, split and match cost no per-call setup. │
+//└──────────────────────────────────────────────────────────────┘
+
+template <typename Codec /* haystack */> class searcher
 {
-	template <typename Codec>
-	static constexpr auto __difcu__(const typename Codec::T* head, const typename Codec::T* tail) noexcept -> size_t;
+	using T = typename Codec::T;
 
-	template <typename Codec>
-	static constexpr auto __difcp__(const typename Codec::T* head, const typename Codec::T* tail) noexcept -> size_t;
+	enum mode_t : uint8_t
+	{
+		FILTER,   // short; vector first/last unit filter
+		HORSPOOL, // long; bad character shift
+		TWO_WAY,  // self-overlapping; linear worst case
+	};
 
-	template <typename Codec,
-	          typename Other>
-	static constexpr auto __fcopy__(const typename Other::T* head, const typename Other::T* tail,
-	                                                               /*&*/ typename Codec::T* dest) noexcept -> size_t;
+	str<Codec> needle;
 
-	template <typename Codec,
-	          typename Other>
-	static constexpr auto __rcopy__(const typename Other::T* head, const typename Other::T* tail,
-	                                                               /*&*/ typename Codec::T* dest) noexcept -> size_t;
+	// Two-Way
+	ptrdiff_t ell;
+	size_t per;
+	bool periodic;
 
-	template <typename Codec,
-	          typename Other>
-	static constexpr auto __equal__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
-	                                const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> bool;
+	// Horspool; keyed by the low byte of a unit
+	size_t skip[256] {};
 
-	template <typename Codec,
-	          typename Other>
-	static constexpr auto __nqual__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
-	                                const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> bool;
+	mode_t mode;
 
-	template <typename Codec,
-	          typename Other>
-	static constexpr auto __swith__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
-	                                const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> bool;
+	constexpr auto __init__() noexcept -> void;
 
-	template <typename Codec,
-	          typename Other>
-	static constexpr auto __ewith__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
-	                                const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> bool;
+	// calls 'fun' on every distinct match; stops early if it returns false.
+	constexpr auto __scan__(const T* head, const T* tail, const auto& fun) const noexcept -> void;
 
-	template <typename Codec,
-	          typename Other>
-	static constexpr auto __scan__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
-	                               const typename Other::T* rhs_0, const typename Other::T* rhs_N,
-	                                                               const auto& fun /* lambda E */) noexcept -> void;
+public:
 
-	template <typename Codec,
-	          typename Other>
-	static constexpr auto __split__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
-	                                const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> std::vector<txt<Codec>>;
+	template <typename Other, typename Arena>
+	constexpr searcher(__OWNED__(value)) noexcept;
+	template <typename Other /* can't own */>
+	constexpr searcher(__SLICE__(value)) noexcept;
+	template <size_t                       N>
+	constexpr searcher(__EQSTR__(value)) noexcept requires (std::is_same_v<T, char>);
+	template <size_t                       N>
+	constexpr searcher(__08STR__(value)) noexcept /* encoding of char8_t is trivial */;
+	template <size_t                       N>
+	constexpr searcher(__16STR__(value)) noexcept /* encoding of char16_t is trivial */;
+	template <size_t                       N>
+	constexpr searcher(__32STR__(value)) noexcept /* encoding of char32_t is trivial */;
 
-	template <typename Codec,
-	          typename Other>
-	static constexpr auto __match__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
-	                                const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> std::vector<txt<Codec>>;
+	// returns the 1st match, if any.
+	constexpr auto find(txt<Codec> text) const noexcept -> std::optional<txt<Codec>>;
+	// returns the number of distinct matches.
+	constexpr auto count(txt<Codec> text) const noexcept -> size_t;
+	// returns a list of string slice, of which is a product of split aka division.
+	constexpr auto split(txt<Codec> text) const noexcept -> std::vector<txt<Codec>>;
+	// returns a list of string slice, of which is a product of search aka match.
+	constexpr auto match(txt<Codec> text) const noexcept -> std::vector<txt<Codec>>;
+};
 
-	template <typename Codec>
-	static constexpr auto __substr__(const typename Codec::T* head, const typename Codec::T* tail, clamp  start, clamp  until) noexcept -> txt<Codec>;
+//┌──────────────────────────────────────────────────────────────┐
+//│ many needles, one pass; Aho-Corasick over the bytes of code  │
+//│ units, as a dense DFA whose columns are byte classes rather  │
+//│ than bytes, so that a row is only as wide as the set of      │
+//│ bytes the needles actually use.                              │
+//└──────────────────────────────────────────────────────────────┘
 
-	template <typename Codec>
-	static constexpr auto __substr__(const typename Codec::T* head, const typename Codec::T* tail, clamp  start, range  until) noexcept -> txt<Codec>;
+template <typename Codec /* haystack */> class multi_searcher
+{
+	using T = typename Codec::T;
 
-	template <typename Codec>
-	static constexpr auto __substr__(const typename Codec::T* head, const typename Codec::T* tail, size_t start, clamp  until) noexcept -> txt<Codec>;
+	static constexpr const uint32_t NONE {UINT32_MAX};
+	static constexpr const uint32_t FLAG {1u << 31};
 
-	template <typename Codec>
-	static constexpr auto __substr__(const typename Codec::T* head, const typename Codec::T* tail, size_t start, range  until) noexcept -> txt<Codec>;
+	// byte -> column; 0 for bytes no needle uses
+	uint16_t cls[256] {};
+	// columns per row
+	size_t width {1};
+
+	// row + column -> row; rows are premultiplied by width, and flagged if a needle ends there
+	std::vector<uint32_t> delta;
+	// state -> 1st needle that ends here or at one of its suffixes
+	std::vector<uint32_t> out;
+	// needle -> next needle that ends at the same state or at one of its suffixes
+	std::vector<uint32_t> next;
+	// needle -> its size in code units
+	std::vector<size_t> size;
+
+	constexpr auto __init__(const std::vector<str<Codec>>& needles) noexcept -> void;
+
+public:
+
+	template <typename... Args> requires (0 < sizeof...(Args) && (std::is_constructible_v<str<Codec>, const Args&> && ...))
+	constexpr multi_searcher(const Args&... needles) noexcept;
+
+	template <std::ranges::input_range Range> requires (!std::is_constructible_v<str<Codec>, const Range&>)
+	constexpr multi_searcher(const Range& needles) noexcept;
+
+	// calls fun(id, slice) on every match of every needle, overlaps included; stops early if it returns false.
+	constexpr auto scan(txt<Codec> text, const auto& fun) const noexcept -> void;
+	// returns the number of matches of every needle, overlaps included.
+	constexpr auto count(txt<Codec> text) const noexcept -> size_t;
+};
+
+//┌──────────────────────────────────────────────────────────────┐
+//│ lazy split and match; each piece is only searched for once   │
+//│ the iterator gets there, so that stopping early costs no     │
+//│ more than the pieces seen, and no list is ever allocated.    │
+//│ slices point into the haystack, not into the range itself.   │
+//│ the view owns its searcher; iterators point at it, so they   │
+//│ need the view alive. pass a prepared searcher instead to     │
+//│ share it; such a view only refers to it, so that the view    │
+//│ and its iterators are borrowed for as long as the needle is. │
+//└──────────────────────────────────────────────────────────────┘
+
+template <typename Codec /* haystack */, typename Needle> class split_view : public std::ranges::view_interface<split_view<Codec, Needle>>
+{
+	using T = typename Codec::T;
+
+	txt<Codec> text;
+	Needle needle;
+
+	// owned or referred to, the same searcher
+	constexpr auto __needle__() const noexcept -> const searcher<Codec>&;
+
+public:
+
+	class iterator
+	{
+		txt<Codec> text {nullptr, nullptr};
+		const searcher<Codec>* needle {nullptr};
+
+		// current piece; nullptr once past the last one
+		const T* head {nullptr};
+		const T* tail {nullptr};
+
+		// start of the next piece
+		const T* last {nullptr};
+		// where the search resumes
+		const T* ptr {nullptr};
+
+		constexpr auto __next__() noexcept -> void;
+
+	public:
+
+		using iterator_concept = std::forward_iterator_tag;
+		using difference_type = std::ptrdiff_t;
+		using value_type = txt<Codec>;
+		using reference = txt<Codec>;
+
+		constexpr iterator(txt<Codec> text, const searcher<Codec>* needle) noexcept;
+
+		// stl compat; must be default constructible
+		constexpr  iterator() noexcept = default;
+		constexpr ~iterator() noexcept = default;
+
+		constexpr auto operator*() const noexcept -> value_type;
+
+		constexpr auto operator++(   ) noexcept -> iterator&;
+		constexpr auto operator++(int) noexcept -> iterator;
+
+		constexpr auto operator==(const iterator& rhs) const noexcept -> bool;
+		constexpr auto operator==(std::default_sentinel_t) const noexcept -> bool;
+	};
+
+	constexpr split_view(txt<Codec> text, Needle needle) noexcept;
+
+	constexpr auto begin() const noexcept -> iterator;
+	constexpr auto end() const noexcept -> std::default_sentinel_t;
+};
+
+template <typename Codec /* haystack */, typename Needle> class match_view : public std::ranges::view_interface<match_view<Codec, Needle>>
+{
+	using T = typename Codec::T;
+
+	txt<Codec> text;
+	Needle needle;
+
+	// owned or referred to, the same searcher
+	constexpr auto __needle__() const noexcept -> const searcher<Codec>&;
+
+public:
+
+	class iterator
+	{
+		txt<Codec> text {nullptr, nullptr};
+		const searcher<Codec>* needle {nullptr};
+
+		// current match; nullptr once past the last one
+		const T* head {nullptr};
+		const T* tail {nullptr};
+
+		constexpr auto __next__(const T* ptr) noexcept -> void;
+
+	public:
+
+		using iterator_concept = std::forward_iterator_tag;
+		using difference_type = std::ptrdiff_t;
+		using value_type = txt<Codec>;
+		using reference = txt<Codec>;
+
+		constexpr iterator(txt<Codec> text, const searcher<Codec>* needle) noexcept;
+
+		// stl compat; must be default constructible
+		constexpr  iterator() noexcept = default;
+		constexpr ~iterator() noexcept = default;
+
+		constexpr auto operator*() const noexcept -> value_type;
+
+		constexpr auto operator++(   ) noexcept -> iterator&;
+		constexpr auto operator++(int) noexcept -> iterator;
+
+		constexpr auto operator==(const iterator& rhs) const noexcept -> bool;
+		constexpr auto operator==(std::default_sentinel_t) const noexcept -> bool;
+	};
+
+	constexpr match_view(txt<Codec> text, Needle needle) noexcept;
+
+	constexpr auto begin() const noexcept -> iterator;
+	constexpr auto end() const noexcept -> std::default_sentinel_t;
+};
+
+namespace detail
+{
+	enum class isa : uint8_t
+	{
+		SCALAR,
+		SSE42,
+		AVX2,
+		AVX512,
+	};
+
+	// the widest instruction set this machine runs, probed once and capped by UTF_SIMD.
+	inline auto __isa__() noexcept -> isa;
+
+	template <typename Codec,
+	          typename Other>
+	static constexpr auto __ascii__(const typename Other::T* head, const typename Other::T* tail,
+	                                                               /*&*/ typename Codec::T* dest) noexcept -> size_t;
+
+	static inline auto __ostream__(std::ostream& os, const char16_t* head, const char16_t* tail) noexcept -> void;
+
+	template <typename Codec,
+	          typename Other>
+	static constexpr auto __vcopy__(const typename Other::T*& head, const typename Other::T* tail,
+	                                                                /*&*/ typename Codec::T*& dest) noexcept -> void;
+
+	template <typename Codec>
+	static constexpr auto __difcu__(const typename Codec::T* head, const typename Codec::T* tail) noexcept -> size_t;
+
+	template <typename Codec>
+	static constexpr auto __difcp__(const typename Codec::T* head, const typename Codec::T* tail) noexcept -> size_t;
+
+	template <typename Codec>
+	static constexpr auto __check__(const typename Codec::T* head, const typename Codec::T* tail) noexcept -> std::expected<void, error>;
+
+	template <typename Codec,
+	          typename Other>
+	static constexpr auto __bound__(const typename Other::T* head, const typename Other::T* tail) noexcept -> size_t;
+
+	template <typename Codec,
+	          typename Other>
+	static constexpr auto __fcopy__(const typename Other::T* head, const typename Other::T* tail,
+	                                                               /*&*/ typename Codec::T* dest) noexcept -> size_t;
+
+	template <typename Codec,
+	          typename Other>
+	static constexpr auto __rcopy__(const typename Other::T* head, const typename Other::T* tail,
+	                                                               /*&*/ typename Codec::T* dest) noexcept -> size_t;
+
+	template <typename Codec,
+	          typename Other>
+	static constexpr auto __equal__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
+	                                const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> bool;
+
+	template <typename Codec,
+	          typename Other>
+	static constexpr auto __nqual__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
+	                                const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> bool;
+
+	template <typename Codec,
+	          typename Other>
+	static constexpr auto __swith__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
+	                                const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> bool;
+
+	template <typename Codec,
+	          typename Other>
+	static constexpr auto __ewith__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
+	                                const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> bool;
+
+	// Crochemore–Perrin; returns the start of the maximal suffix of [head, tail), under the (flipped) order, and its period.
+	template <bool flip, typename It>
+	static constexpr auto __suffix__(It head, It tail, size_t& period) noexcept -> ptrdiff_t;
+
+	// Two-Way; splits [head, tail) at 'ell' with a shift of 'per'; returns whether the left half repeats.
+	template <typename It>
+	static constexpr auto __factor__(It head, It tail, ptrdiff_t& ell, size_t& per) noexcept -> bool;
+
+	// Two-Way; returns the 1st match of [rhs_0, rhs_N) in [lhs_0, lhs_N), or It {} (nullptr); walks backward on reverse iterators.
+	template <typename It>
+	static constexpr auto __twoway__(It lhs_0, It lhs_N,
+	                                 It rhs_0, It rhs_N, ptrdiff_t ell, size_t per, bool periodic) noexcept -> It;
+
+	// Horspool; returns the 1st match, or nullptr once out of credit or room; verification spends it, shifts earn it back.
+	template <typename T>
+	static constexpr auto __horspool__(const T*& head, const T* tail, const T* rhs, size_t len, const size_t (&skip)[256], ptrdiff_t& credit) noexcept -> const T*;
+
+	// vector kernels; returns the 1st match of a 2+ unit needle, or nullptr once out of credit or room.
+	template <typename T>
+	static constexpr auto __filter__(const T*& head, const T* tail, const T* rhs, size_t len, ptrdiff_t& credit) noexcept -> const T*;
+
+	// calls fun(head, tail) with [rhs_0, rhs_N) in the haystack's codec; not at all if a code point has no place in it.
+	template <typename Codec,
+	          typename Other>
+	static constexpr auto __needle__(const typename Other::T* rhs_0, const typename Other::T* rhs_N, const auto& fun) noexcept -> void;
+
+	template <typename Codec,
+	          typename Other>
+	static constexpr auto __scan__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
+	                               const typename Other::T* rhs_0, const typename Other::T* rhs_N,
+	                                                               const auto& fun /* lambda E */) noexcept -> void;
+
+	// returns the start of the last occurrence, overlaps included, or nullptr; walks from the tail.
+	template <typename Codec,
+	          typename Other>
+	static constexpr auto __rfind__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
+	                                const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> const typename Codec::T*;
+
+	// returns the start of the nth (0-based) distinct match, or nullptr.
+	template <typename Codec,
+	          typename Other>
+	static constexpr auto __nth__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
+	                              const typename Other::T* rhs_0, const typename Other::T* rhs_N, size_t nth) noexcept -> const typename Codec::T*;
+
+	// appends where every distinct match starts; code points are counted from one match to the next, not from the head.
+	template <typename Codec,
+	          typename Other>
+	static constexpr auto __every__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
+	                                const typename Other::T* rhs_0, const typename Other::T* rhs_N, std::vector<offset>& out, index mode) noexcept -> size_t;
+
+	template <typename Codec>
+	static constexpr auto __offset__(const typename Codec::T* head, const typename Codec::T* hit, index mode) noexcept -> std::optional<offset>;
+
+	template <typename Codec,
+	          typename Other>
+	static constexpr auto __count__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
+	                                const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> size_t;
+
+	template <typename Codec,
+	          typename Other>
+	static constexpr auto __exist__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
+	                                const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> bool;
+
+	template <typename Codec,
+	          typename Other>
+	static constexpr auto __split__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
+	                                const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> std::vector<txt<Codec>>;
+
+	template <typename Codec,
+	          typename Other>
+	static constexpr auto __match__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
+	                                const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> std::vector<txt<Codec>>;
+
+	template <typename Codec>
+	static constexpr auto __substr__(const typename Codec::T* head, const typename Codec::T* tail, clamp  start, clamp  until) noexcept -> txt<Codec>;
+
+	template <typename Codec>
+	static constexpr auto __substr__(const typename Codec::T* head, const typename Codec::T* tail, clamp  start, range  until) noexcept -> txt<Codec>;
+
+	template <typename Codec>
+	static constexpr auto __substr__(const typename Codec::T* head, const typename Codec::T* tail, size_t start, clamp  until) noexcept -> txt<Codec>;
+
+	template <typename Codec>
+	static constexpr auto __substr__(const typename Codec::T* head, const typename Codec::T* tail, size_t start, range  until) noexcept -> txt<Codec>;
 
 	template <typename Codec>
 	static constexpr auto __substr__(const typename Codec::T* head, const typename Codec::T* tail, size_t start, size_t until) noexcept -> txt<Codec>;
@@ -1178,15 +1928,32 @@ namespace detail
 
 template <typename Other, typename Arena> inline auto operator<<(std::ostream& os, __OWNED__(str)) noexcept -> decltype(os)
 {
-	for (const auto code : str) { ::operator<<(os, code); } return os;
+	if constexpr (std::is_same_v<Other, codec<"UTF-16">>)
+	     { detail::__ostream__(os, str.head(), str.tail()); return os; }
+	else { for (const auto code : str) { ::operator<<(os, code); } return os; }
 }
 
 template <typename Other /* can't own */> inline auto operator<<(std::ostream& os, __SLICE__(str)) noexcept -> decltype(os)
 {
-	for (const auto code : str) { ::operator<<(os, code); } return os;
+	if constexpr (std::is_same_v<Other, codec<"UTF-16">>)
+	     { detail::__ostream__(os, str.head(), str.tail()); return os; }
+	else { for (const auto code : str) { ::operator<<(os, code); } return os; }
 }
 
 #pragma endregion iostream
+#pragma region validate
+
+template <typename Other, typename Arena> constexpr auto validate(__OWNED__(str)) noexcept -> std::expected<void, error>
+{
+	return detail::__check__<Other>(str.head(), str.tail());
+}
+
+template <typename Other /* can't own */> constexpr auto validate(__SLICE__(str)) noexcept -> std::expected<void, error>
+{
+	return detail::__check__<Other>(str.head(), str.tail());
+}
+
+#pragma endregion validate
 #pragma region codec<"ASCII">
 
 constexpr auto codec<"ASCII">::size([[maybe_unused]] char32_t code) noexcept -> int8_t
@@ -1499,18 +2266,18 @@ constexpr auto codec<"UTF-16">::decode(const T* in, char32_t& out, int8_t step)
 		case +2:
 		{
 			out = 0x10000 // supplymentary
-			      |
+			      +
 			      ((in[+0] - 0xD800) << 10)
-			      |
+			      +
 			      ((in[+1] - 0xDC00) << 00);
 			break;
 		}
 		case -2:
 		{
 			out = 0x10000 // supplymentary
-			      |
+			      +
 			      ((in[-2] - 0xD800) << 10)
-			      |
+			      +
 			      ((in[-1] - 0xDC00) << 00);
 			break;
 		}
@@ -1599,6 +2366,16 @@ template <typename Class /* CRTP core */> constexpr auto API<Class>::size() cons
 
 template <typename Class /* CRTP core */> constexpr auto API<Class>::length() const noexcept -> size_t
 {
+	if constexpr (!std::is_same_v<Class, txt<Codec>>)
+	{
+		const auto self {static_cast<const Class*>(this)};
+
+		// kept up to date by whatever mutates it; a reader never fills it in
+		if (const auto out {self->__length__()})
+		{
+			return *out;
+		}
+	}
 	return detail::__difcp__<Codec /*&*/>(this->head(), this->tail());
 }
 
@@ -1677,37 +2454,73 @@ template <size_t                       N> constexpr auto API<Class>::ends_with(_
 template <typename Class /* CRTP core */>
 template <typename Other, typename Arena> constexpr auto API<Class>::contains(__OWNED__(value)) const noexcept -> size_t
 {
-	return detail::__match__<Codec, Other>(this->head(), this->tail(), value.head(), value.tail()).size();
+	return detail::__count__<Codec, Other>(this->head(), this->tail(), value.head(), value.tail());
 }
 
 template <typename Class /* CRTP core */>
 template <typename Other /* can't own */> constexpr auto API<Class>::contains(__SLICE__(value)) const noexcept -> size_t
 {
-	return detail::__match__<Codec, Other>(this->head(), this->tail(), value.head(), value.tail()).size();
+	return detail::__count__<Codec, Other>(this->head(), this->tail(), value.head(), value.tail());
 }
 
 template <typename Class /* CRTP core */>
 template <size_t                       N> constexpr auto API<Class>::contains(__EQSTR__(value)) const noexcept -> size_t requires (std::is_same_v<T, char>)
 {
-	return detail::__match__<Codec, Codec>(this->head(), this->tail(), &value[N - N], &value[N - 1]).size();
+	return detail::__count__<Codec, Codec>(this->head(), this->tail(), &value[N - N], &value[N - 1]);
 }
 
 template <typename Class /* CRTP core */>
 template <size_t                       N> constexpr auto API<Class>::contains(__08STR__(value)) const noexcept -> size_t /* encoding of char8_t is trivial */
 {
-	return detail::__match__<Codec, codec<"UTF-8">>(this->head(), this->tail(), &value[N - N], &value[N - 1]).size();
+	return detail::__count__<Codec, codec<"UTF-8">>(this->head(), this->tail(), &value[N - N], &value[N - 1]);
 }
 
 template <typename Class /* CRTP core */>
 template <size_t                       N> constexpr auto API<Class>::contains(__16STR__(value)) const noexcept -> size_t /* encoding of char16_t is trivial */
 {
-	return detail::__match__<Codec, codec<"UTF-16">>(this->head(), this->tail(), &value[N - N], &value[N - 1]).size();
+	return detail::__count__<Codec, codec<"UTF-16">>(this->head(), this->tail(), &value[N - N], &value[N - 1]);
 }
 
 template <typename Class /* CRTP core */>
 template <size_t                       N> constexpr auto API<Class>::contains(__32STR__(value)) const noexcept -> size_t /* encoding of char32_t is trivial */
 {
-	return detail::__match__<Codec, codec<"UTF-32">>(this->head(), this->tail(), &value[N - N], &value[N - 1]).size();
+	return detail::__count__<Codec, codec<"UTF-32">>(this->head(), this->tail(), &value[N - N], &value[N - 1]);
+}
+
+template <typename Class /* CRTP core */>
+template <typename Other, typename Arena> constexpr auto API<Class>::includes(__OWNED__(value)) const noexcept -> bool
+{
+	return detail::__exist__<Codec, Other>(this->head(), this->tail(), value.head(), value.tail());
+}
+
+template <typename Class /* CRTP core */>
+template <typename Other /* can't own */> constexpr auto API<Class>::includes(__SLICE__(value)) const noexcept -> bool
+{
+	return detail::__exist__<Codec, Other>(this->head(), this->tail(), value.head(), value.tail());
+}
+
+template <typename Class /* CRTP core */>
+template <size_t                       N> constexpr auto API<Class>::includes(__EQSTR__(value)) const noexcept -> bool requires (std::is_same_v<T, char>)
+{
+	return detail::__exist__<Codec, Codec>(this->head(), this->tail(), &value[N - N], &value[N - 1]);
+}
+
+template <typename Class /* CRTP core */>
+template <size_t                       N> constexpr auto API<Class>::includes(__08STR__(value)) const noexcept -> bool /* encoding of char8_t is trivial */
+{
+	return detail::__exist__<Codec, codec<"UTF-8">>(this->head(), this->tail(), &value[N - N], &value[N - 1]);
+}
+
+template <typename Class /* CRTP core */>
+template <size_t                       N> constexpr auto API<Class>::includes(__16STR__(value)) const noexcept -> bool /* encoding of char16_t is trivial */
+{
+	return detail::__exist__<Codec, codec<"UTF-16">>(this->head(), this->tail(), &value[N - N], &value[N - 1]);
+}
+
+template <typename Class /* CRTP core */>
+template <size_t                       N> constexpr auto API<Class>::includes(__32STR__(value)) const noexcept -> bool /* encoding of char32_t is trivial */
+{
+	return detail::__exist__<Codec, codec<"UTF-32">>(this->head(), this->tail(), &value[N - N], &value[N - 1]);
 }
 
 template <typename Class /* CRTP core */>
@@ -1782,2253 +2595,7094 @@ template <size_t                       N> constexpr auto API<Class>::match(__32S
 	return detail::__match__<Codec, codec<"UTF-32">>(this->head(), this->tail(), &value[N - N], &value[N - 1]);
 }
 
-template <typename Class /* CRTP core */> constexpr auto API<Class>::substr(clamp  start, clamp  until) const noexcept -> txt<Codec>
+template <typename Class /* CRTP core */>
+template <typename Other, typename Arena> constexpr auto API<Class>::split_view(__OWNED__(value)) const noexcept -> utf::split_view<Codec>
 {
-	return detail::__substr__<Codec /*&*/>(this->head(), this->tail(), start, until);
+	return {{this->head(), this->tail()}, searcher<Codec> {value}};
 }
 
-template <typename Class /* CRTP core */> constexpr auto API<Class>::substr(clamp  start, range  until) const noexcept -> txt<Codec>
+template <typename Class /* CRTP core */>
+template <typename Other /* can't own */> constexpr auto API<Class>::split_view(__SLICE__(value)) const noexcept -> utf::split_view<Codec>
 {
-	return detail::__substr__<Codec /*&*/>(this->head(), this->tail(), start, until);
+	return {{this->head(), this->tail()}, searcher<Codec> {value}};
 }
 
-template <typename Class /* CRTP core */> constexpr auto API<Class>::substr(size_t start, clamp  until) const noexcept -> txt<Codec>
+template <typename Class /* CRTP core */>
+template <size_t                       N> constexpr auto API<Class>::split_view(__EQSTR__(value)) const noexcept -> utf::split_view<Codec> requires (std::is_same_v<T, char>)
 {
-	return detail::__substr__<Codec /*&*/>(this->head(), this->tail(), start, until);
+	return {{this->head(), this->tail()}, searcher<Codec> {value}};
 }
 
-template <typename Class /* CRTP core */> constexpr auto API<Class>::substr(size_t start, range  until) const noexcept -> txt<Codec>
+template <typename Class /* CRTP core */>
+template <size_t                       N> constexpr auto API<Class>::split_view(__08STR__(value)) const noexcept -> utf::split_view<Codec> /* encoding of char8_t is trivial */
 {
-	return detail::__substr__<Codec /*&*/>(this->head(), this->tail(), start, until);
+	return {{this->head(), this->tail()}, searcher<Codec> {value}};
 }
 
-template <typename Class /* CRTP core */> constexpr auto API<Class>::substr(size_t start, size_t until) const noexcept -> txt<Codec>
+template <typename Class /* CRTP core */>
+template <size_t                       N> constexpr auto API<Class>::split_view(__16STR__(value)) const noexcept -> utf::split_view<Codec> /* encoding of char16_t is trivial */
 {
-	return detail::__substr__<Codec /*&*/>(this->head(), this->tail(), start, until);
+	return {{this->head(), this->tail()}, searcher<Codec> {value}};
 }
 
-template <typename Class /* CRTP core */> constexpr auto API<Class>::begin() const noexcept -> const_forward_iterator
+template <typename Class /* CRTP core */>
+template <size_t                       N> constexpr auto API<Class>::split_view(__32STR__(value)) const noexcept -> utf::split_view<Codec> /* encoding of char32_t is trivial */
 {
-	return {this->head()};
+	return {{this->head(), this->tail()}, searcher<Codec> {value}};
 }
 
-template <typename Class /* CRTP core */> constexpr auto API<Class>::end() const noexcept -> const_forward_iterator
+template <typename Class /* CRTP core */> constexpr auto API<Class>::split_view(const searcher<Codec>& value) const noexcept -> utf::split_view<Codec, std::reference_wrapper<const searcher<Codec>>>
 {
-	return {this->tail()};
+	return {{this->head(), this->tail()}, std::cref(value)};
 }
 
-template <typename Class /* CRTP core */> constexpr auto API<Class>::rbegin() const noexcept -> const_reverse_iterator
+template <typename Class /* CRTP core */>
+template <typename Other, typename Arena> constexpr auto API<Class>::match_view(__OWNED__(value)) const noexcept -> utf::match_view<Codec>
 {
-	return {this->tail()};
+	return {{this->head(), this->tail()}, searcher<Codec> {value}};
 }
 
-template <typename Class /* CRTP core */> constexpr auto API<Class>::rend() const noexcept -> const_reverse_iterator
+template <typename Class /* CRTP core */>
+template <typename Other /* can't own */> constexpr auto API<Class>::match_view(__SLICE__(value)) const noexcept -> utf::match_view<Codec>
 {
-	return {this->head()};
+	return {{this->head(), this->tail()}, searcher<Codec> {value}};
 }
 
-template <typename Class /* CRTP core */> constexpr auto API<Class>::operator[](size_t value) const noexcept -> decltype(auto)
+template <typename Class /* CRTP core */>
+template <size_t                       N> constexpr auto API<Class>::match_view(__EQSTR__(value)) const noexcept -> utf::match_view<Codec> requires (std::is_same_v<T, char>)
 {
-	return typename Class::reader {static_cast<Class*>(this), value};
+	return {{this->head(), this->tail()}, searcher<Codec> {value}};
 }
 
-template <typename Class /* CRTP core */> constexpr auto API<Class>::operator[](size_t value) /*&*/ noexcept -> decltype(auto)
+template <typename Class /* CRTP core */>
+template <size_t                       N> constexpr auto API<Class>::match_view(__08STR__(value)) const noexcept -> utf::match_view<Codec> /* encoding of char8_t is trivial */
 {
-	return typename Class::writer {static_cast<Class*>(this), value};
+	return {{this->head(), this->tail()}, searcher<Codec> {value}};
 }
 
 template <typename Class /* CRTP core */>
-template <typename Other, typename Arena> constexpr auto API<Class>::operator==(__OWNED__(rhs)) const noexcept -> bool
+template <size_t                       N> constexpr auto API<Class>::match_view(__16STR__(value)) const noexcept -> utf::match_view<Codec> /* encoding of char16_t is trivial */
 {
-	return detail::__equal__<Codec, Other>(this->head(), this->tail(), rhs.head(), rhs.tail());
+	return {{this->head(), this->tail()}, searcher<Codec> {value}};
 }
 
 template <typename Class /* CRTP core */>
-template <typename Other /* can't own */> constexpr auto API<Class>::operator==(__SLICE__(rhs)) const noexcept -> bool
+template <size_t                       N> constexpr auto API<Class>::match_view(__32STR__(value)) const noexcept -> utf::match_view<Codec> /* encoding of char32_t is trivial */
 {
-	return detail::__equal__<Codec, Other>(this->head(), this->tail(), rhs.head(), rhs.tail());
+	return {{this->head(), this->tail()}, searcher<Codec> {value}};
 }
 
-template <typename Class /* CRTP core */>
-template <size_t                       N> constexpr auto API<Class>::operator==(__EQSTR__(rhs)) const noexcept -> bool requires (std::is_same_v<T, char>)
+template <typename Class /* CRTP core */> constexpr auto API<Class>::match_view(const searcher<Codec>& value) const noexcept -> utf::match_view<Codec, std::reference_wrapper<const searcher<Codec>>>
 {
-	return detail::__equal__<Codec, Codec>(this->head(), this->tail(), &rhs[N - N], &rhs[N - 1]);
+	return {{this->head(), this->tail()}, std::cref(value)};
 }
 
 template <typename Class /* CRTP core */>
-template <size_t                       N> constexpr auto API<Class>::operator==(__08STR__(rhs)) const noexcept -> bool /* encoding of char8_t is trivial */
+template <typename Other, typename Arena> constexpr auto API<Class>::find(__OWNED__(value), index mode) const noexcept -> std::optional<offset>
 {
-	return detail::__equal__<Codec, codec<"UTF-8">>(this->head(), this->tail(), &rhs[N - N], &rhs[N - 1]);
+	return detail::__offset__<Codec>(this->head(), detail::__nth__<Codec, Other>(this->head(), this->tail(), value.head(), value.tail(), 0), mode);
 }
 
 template <typename Class /* CRTP core */>
-template <size_t                       N> constexpr auto API<Class>::operator==(__16STR__(rhs)) const noexcept -> bool /* encoding of char16_t is trivial */
+template <typename Other /* can't own */> constexpr auto API<Class>::find(__SLICE__(value), index mode) const noexcept -> std::optional<offset>
 {
-	return detail::__equal__<Codec, codec<"UTF-16">>(this->head(), this->tail(), &rhs[N - N], &rhs[N - 1]);
+	return detail::__offset__<Codec>(this->head(), detail::__nth__<Codec, Other>(this->head(), this->tail(), value.head(), value.tail(), 0), mode);
 }
 
 template <typename Class /* CRTP core */>
-template <size_t                       N> constexpr auto API<Class>::operator==(__32STR__(rhs)) const noexcept -> bool /* encoding of char32_t is trivial */
+template <size_t                       N> constexpr auto API<Class>::find(__EQSTR__(value), index mode) const noexcept -> std::optional<offset> requires (std::is_same_v<T, char>)
 {
-	return detail::__equal__<Codec, codec<"UTF-32">>(this->head(), this->tail(), &rhs[N - N], &rhs[N - 1]);
+	return detail::__offset__<Codec>(this->head(), detail::__nth__<Codec, Codec>(this->head(), this->tail(), &value[N - N], &value[N - 1], 0), mode);
 }
 
 template <typename Class /* CRTP core */>
-template <typename Other, typename Arena> constexpr auto API<Class>::operator!=(__OWNED__(rhs)) const noexcept -> bool
+template <size_t                       N> constexpr auto API<Class>::find(__08STR__(value), index mode) const noexcept -> std::optional<offset> /* encoding of char8_t is trivial */
 {
-	return detail::__nqual__<Codec, Other>(this->head(), this->tail(), rhs.head(), rhs.tail());
+	return detail::__offset__<Codec>(this->head(), detail::__nth__<Codec, codec<"UTF-8">>(this->head(), this->tail(), &value[N - N], &value[N - 1], 0), mode);
 }
 
 template <typename Class /* CRTP core */>
-template <typename Other /* can't own */> constexpr auto API<Class>::operator!=(__SLICE__(rhs)) const noexcept -> bool
+template <size_t                       N> constexpr auto API<Class>::find(__16STR__(value), index mode) const noexcept -> std::optional<offset> /* encoding of char16_t is trivial */
 {
-	return detail::__nqual__<Codec, Other>(this->head(), this->tail(), rhs.head(), rhs.tail());
+	return detail::__offset__<Codec>(this->head(), detail::__nth__<Codec, codec<"UTF-16">>(this->head(), this->tail(), &value[N - N], &value[N - 1], 0), mode);
 }
 
 template <typename Class /* CRTP core */>
-template <size_t                       N> constexpr auto API<Class>::operator!=(__EQSTR__(rhs)) const noexcept -> bool requires (std::is_same_v<T, char>)
+template <size_t                       N> constexpr auto API<Class>::find(__32STR__(value), index mode) const noexcept -> std::optional<offset> /* encoding of char32_t is trivial */
 {
-	return detail::__nqual__<Codec, Codec>(this->head(), this->tail(), &rhs[N - N], &rhs[N - 1]);
+	return detail::__offset__<Codec>(this->head(), detail::__nth__<Codec, codec<"UTF-32">>(this->head(), this->tail(), &value[N - N], &value[N - 1], 0), mode);
 }
 
 template <typename Class /* CRTP core */>
-template <size_t                       N> constexpr auto API<Class>::operator!=(__08STR__(rhs)) const noexcept -> bool /* encoding of char8_t is trivial */
+template <typename Other, typename Arena> constexpr auto API<Class>::rfind(__OWNED__(value), index mode) const noexcept -> std::optional<offset>
 {
-	return detail::__nqual__<Codec, codec<"UTF-8">>(this->head(), this->tail(), &rhs[N - N], &rhs[N - 1]);
+	return detail::__offset__<Codec>(this->head(), detail::__rfind__<Codec, Other>(this->head(), this->tail(), value.head(), value.tail()), mode);
 }
 
 template <typename Class /* CRTP core */>
-template <size_t                       N> constexpr auto API<Class>::operator!=(__16STR__(rhs)) const noexcept -> bool /* encoding of char16_t is trivial */
+template <typename Other /* can't own */> constexpr auto API<Class>::rfind(__SLICE__(value), index mode) const noexcept -> std::optional<offset>
 {
-	return detail::__nqual__<Codec, codec<"UTF-16">>(this->head(), this->tail(), &rhs[N - N], &rhs[N - 1]);
+	return detail::__offset__<Codec>(this->head(), detail::__rfind__<Codec, Other>(this->head(), this->tail(), value.head(), value.tail()), mode);
 }
 
 template <typename Class /* CRTP core */>
-template <size_t                       N> constexpr auto API<Class>::operator!=(__32STR__(rhs)) const noexcept -> bool /* encoding of char32_t is trivial */
+template <size_t                       N> constexpr auto API<Class>::rfind(__EQSTR__(value), index mode) const noexcept -> std::optional<offset> requires (std::is_same_v<T, char>)
 {
-	return detail::__nqual__<Codec, codec<"UTF-32">>(this->head(), this->tail(), &rhs[N - N], &rhs[N - 1]);
+	return detail::__offset__<Codec>(this->head(), detail::__rfind__<Codec, Codec>(this->head(), this->tail(), &value[N - N], &value[N - 1]), mode);
 }
 
 template <typename Class /* CRTP core */>
-template <typename Other, typename Arena> constexpr auto API<Class>::operator+(__OWNED__(rhs)) const noexcept -> concat<txt<Codec>, txt<Other>>
+template <size_t                       N> constexpr auto API<Class>::rfind(__08STR__(value), index mode) const noexcept -> std::optional<offset> /* encoding of char8_t is trivial */
 {
-	return {{this->head(), this->tail()}, {rhs.head(), rhs.tail()}};
+	return detail::__offset__<Codec>(this->head(), detail::__rfind__<Codec, codec<"UTF-8">>(this->head(), this->tail(), &value[N - N], &value[N - 1]), mode);
 }
 
 template <typename Class /* CRTP core */>
-template <typename Other /* can't own */> constexpr auto API<Class>::operator+(__SLICE__(rhs)) const noexcept -> concat<txt<Codec>, txt<Other>>
+template <size_t                       N> constexpr auto API<Class>::rfind(__16STR__(value), index mode) const noexcept -> std::optional<offset> /* encoding of char16_t is trivial */
 {
-	return {{this->head(), this->tail()}, {rhs.head(), rhs.tail()}};
+	return detail::__offset__<Codec>(this->head(), detail::__rfind__<Codec, codec<"UTF-16">>(this->head(), this->tail(), &value[N - N], &value[N - 1]), mode);
 }
 
 template <typename Class /* CRTP core */>
-template <size_t                       N> constexpr auto API<Class>::operator+(__EQSTR__(rhs)) const noexcept -> concat<txt<Codec>, txt<Codec>> requires (std::is_same_v<T, char>)
+template <size_t                       N> constexpr auto API<Class>::rfind(__32STR__(value), index mode) const noexcept -> std::optional<offset> /* encoding of char32_t is trivial */
 {
-	return {{this->head(), this->tail()}, {&rhs[N - N], &rhs[N - 1]}};
+	return detail::__offset__<Codec>(this->head(), detail::__rfind__<Codec, codec<"UTF-32">>(this->head(), this->tail(), &value[N - N], &value[N - 1]), mode);
 }
 
 template <typename Class /* CRTP core */>
-template <size_t                       N> constexpr auto API<Class>::operator+(__08STR__(rhs)) const noexcept -> concat<txt<Codec>, txt<codec<"UTF-8">>> /* encoding of char8_t is trivial */
+template <typename Other, typename Arena> constexpr auto API<Class>::find_nth(__OWNED__(value), size_t nth, index mode) const noexcept -> std::optional<offset>
 {
-	return {{this->head(), this->tail()}, {&rhs[N - N], &rhs[N - 1]}};
+	return detail::__offset__<Codec>(this->head(), detail::__nth__<Codec, Other>(this->head(), this->tail(), value.head(), value.tail(), nth), mode);
 }
 
 template <typename Class /* CRTP core */>
-template <size_t                       N> constexpr auto API<Class>::operator+(__16STR__(rhs)) const noexcept -> concat<txt<Codec>, txt<codec<"UTF-16">>> /* encoding of char16_t is trivial */
+template <typename Other /* can't own */> constexpr auto API<Class>::find_nth(__SLICE__(value), size_t nth, index mode) const noexcept -> std::optional<offset>
 {
-	return {{this->head(), this->tail()}, {&rhs[N - N], &rhs[N - 1]}};
+	return detail::__offset__<Codec>(this->head(), detail::__nth__<Codec, Other>(this->head(), this->tail(), value.head(), value.tail(), nth), mode);
 }
 
 template <typename Class /* CRTP core */>
-template <size_t                       N> constexpr auto API<Class>::operator+(__32STR__(rhs)) const noexcept -> concat<txt<Codec>, txt<codec<"UTF-32">>> /* encoding of char32_t is trivial */
+template <size_t                       N> constexpr auto API<Class>::find_nth(__EQSTR__(value), size_t nth, index mode) const noexcept -> std::optional<offset> requires (std::is_same_v<T, char>)
 {
-	return {{this->head(), this->tail()}, {&rhs[N - N], &rhs[N - 1]}};
+	return detail::__offset__<Codec>(this->head(), detail::__nth__<Codec, Codec>(this->head(), this->tail(), &value[N - N], &value[N - 1], nth), mode);
 }
 
-#pragma endregion CRTP
-#pragma region CRTP::concat
-
 template <typename Class /* CRTP core */>
-template <typename   LHS, typename   RHS>
-template <typename Other, typename Arena> constexpr API<Class>::concat<LHS, RHS>::operator str<Other, Arena>() const noexcept
+template <size_t                       N> constexpr auto API<Class>::find_nth(__08STR__(value), size_t nth, index mode) const noexcept -> std::optional<offset> /* encoding of char8_t is trivial */
 {
-	typedef typename Codec::T T;
-	typedef typename Other::T U;
-
-	size_t size {0};
-
-	this->__for_each__([&](auto&& chunk)
-	{
-		[&]<typename 𝒞𝑜𝒹𝑒𝒸>(const txt<𝒞𝑜𝒹𝑒𝒸>& slice)
-		{
-			if constexpr (std::is_same_v<Other, 𝒞𝑜𝒹𝑒𝒸>)
-			{
-				size += detail::__difcu__<Other>(slice.head(), slice.tail());
-			}
-			if constexpr (!std::is_same_v<Other, 𝒞𝑜𝒹𝑒𝒸>)
-			{
-				for (const auto code : slice) { size += Other::size(code); }
-			}
-		}
-		(chunk);
-	});
-
-	str<Other, Arena> out;
-
-	out.capacity(size);
-	out.__size__(size);
-
-	T* ptr {out.__head__()};
-
-	this->__for_each__([&](auto&& chunk)
-	{
-		[&]<typename 𝒞𝑜𝒹𝑒𝒸>(const txt<𝒞𝑜𝒹𝑒𝒸>& slice)
-		{
-			if constexpr (std::is_same_v<Other, 𝒞𝑜𝒹𝑒𝒸>)
-			{
-				ptr += detail::__fcopy__<Other, 𝒞𝑜𝒹𝑒𝒸>(slice.head(), slice.tail(), ptr);
-			}
-			if constexpr (!std::is_same_v<Other, 𝒞𝑜𝒹𝑒𝒸>)
-			{
-				ptr += detail::__fcopy__<Other, 𝒞𝑜𝒹𝑒𝒸>(slice.head(), slice.tail(), ptr);
-			}
-		}
-		(chunk);
-	});
-
-	return out;
+	return detail::__offset__<Codec>(this->head(), detail::__nth__<Codec, codec<"UTF-8">>(this->head(), this->tail(), &value[N - N], &value[N - 1], nth), mode);
 }
 
 template <typename Class /* CRTP core */>
-template <typename   LHS, typename   RHS> constexpr auto API<Class>::concat<LHS, RHS>::__for_each__(const auto&& fun) const noexcept -> void
+template <size_t                       N> constexpr auto API<Class>::find_nth(__16STR__(value), size_t nth, index mode) const noexcept -> std::optional<offset> /* encoding of char16_t is trivial */
 {
-	if constexpr (requires(LHS l) { l.__for_each__(fun); })
-	{ this->lhs.__for_each__(fun); } else { fun(this->lhs); }
-
-	if constexpr (requires(RHS r) { r.__for_each__(fun); })
-	{ this->rhs.__for_each__(fun); } else { fun(this->rhs); }
+	return detail::__offset__<Codec>(this->head(), detail::__nth__<Codec, codec<"UTF-16">>(this->head(), this->tail(), &value[N - N], &value[N - 1], nth), mode);
 }
 
 template <typename Class /* CRTP core */>
-template <typename   LHS, typename   RHS>
-template <typename Other, typename Arena> constexpr auto API<Class>::concat<LHS, RHS>::operator=(__OWNED__(rhs)) noexcept -> concat<blank_t, txt<Other>>
+template <size_t                       N> constexpr auto API<Class>::find_nth(__32STR__(value), size_t nth, index mode) const noexcept -> std::optional<offset> /* encoding of char32_t is trivial */
 {
-	return {{""}, {rhs}};
+	return detail::__offset__<Codec>(this->head(), detail::__nth__<Codec, codec<"UTF-32">>(this->head(), this->tail(), &value[N - N], &value[N - 1], nth), mode);
 }
 
 template <typename Class /* CRTP core */>
-template <typename   LHS, typename   RHS>
-template <typename Other /* can't own */> constexpr auto API<Class>::concat<LHS, RHS>::operator=(__SLICE__(rhs)) noexcept -> concat<blank_t, txt<Other>>
+template <typename Other, typename Arena> constexpr auto API<Class>::find_all_into(__OWNED__(value), std::vector<offset>& out, index mode) const noexcept -> size_t
 {
-	return {{""}, {rhs}};
+	return detail::__every__<Codec, Other>(this->head(), this->tail(), value.head(), value.tail(), out, mode);
 }
 
 template <typename Class /* CRTP core */>
-template <typename   LHS, typename   RHS>
-template <size_t                       N> constexpr auto API<Class>::concat<LHS, RHS>::operator=(__08STR__(rhs)) noexcept -> concat<blank_t, txt<codec<"UTF-8">>>
+template <typename Other /* can't own */> constexpr auto API<Class>::find_all_into(__SLICE__(value), std::vector<offset>& out, index mode) const noexcept -> size_t
 {
-	return {{""}, {rhs}};
+	return detail::__every__<Codec, Other>(this->head(), this->tail(), value.head(), value.tail(), out, mode);
 }
 
 template <typename Class /* CRTP core */>
-template <typename   LHS, typename   RHS>
-template <size_t                       N> constexpr auto API<Class>::concat<LHS, RHS>::operator=(__16STR__(rhs)) noexcept -> concat<blank_t, txt<codec<"UTF-16">>>
+template <size_t                       N> constexpr auto API<Class>::find_all_into(__EQSTR__(value), std::vector<offset>& out, index mode) const noexcept -> size_t requires (std::is_same_v<T, char>)
 {
-	return {{""}, {rhs}};
+	return detail::__every__<Codec, Codec>(this->head(), this->tail(), &value[N - N], &value[N - 1], out, mode);
 }
 
 template <typename Class /* CRTP core */>
-template <typename   LHS, typename   RHS>
-template <size_t                       N> constexpr auto API<Class>::concat<LHS, RHS>::operator=(__32STR__(rhs)) noexcept -> concat<blank_t, txt<codec<"UTF-32">>>
+template <size_t                       N> constexpr auto API<Class>::find_all_into(__08STR__(value), std::vector<offset>& out, index mode) const noexcept -> size_t /* encoding of char8_t is trivial */
 {
-	return {{""}, {rhs}};
+	return detail::__every__<Codec, codec<"UTF-8">>(this->head(), this->tail(), &value[N - N], &value[N - 1], out, mode);
 }
 
 template <typename Class /* CRTP core */>
-template <typename   LHS, typename   RHS>
-template <typename Other, typename Arena> constexpr auto API<Class>::concat<LHS, RHS>::operator+(__OWNED__(rhs)) noexcept -> concat<concat, txt<Other>>
+template <size_t                       N> constexpr auto API<Class>::find_all_into(__16STR__(value), std::vector<offset>& out, index mode) const noexcept -> size_t /* encoding of char16_t is trivial */
 {
-	return {*this, {rhs}};
+	return detail::__every__<Codec, codec<"UTF-16">>(this->head(), this->tail(), &value[N - N], &value[N - 1], out, mode);
 }
 
 template <typename Class /* CRTP core */>
-template <typename   LHS, typename   RHS>
-template <typename Other /* can't own */> constexpr auto API<Class>::concat<LHS, RHS>::operator+(__SLICE__(rhs)) noexcept -> concat<concat, txt<Other>>
+template <size_t                       N> constexpr auto API<Class>::find_all_into(__32STR__(value), std::vector<offset>& out, index mode) const noexcept -> size_t /* encoding of char32_t is trivial */
 {
-	return {*this, {rhs}};
+	return detail::__every__<Codec, codec<"UTF-32">>(this->head(), this->tail(), &value[N - N], &value[N - 1], out, mode);
 }
 
 template <typename Class /* CRTP core */>
-template <typename   LHS, typename   RHS>
-template <size_t                       N> constexpr auto API<Class>::concat<LHS, RHS>::operator+(__08STR__(rhs)) noexcept -> concat<concat, txt<codec<"UTF-8">>>
+template <typename Other, typename Arena, typename Fun> requires (std::is_invocable_v<const Fun&, char32_t>) constexpr auto API<Class>::transform_into(str<Other, Arena>& dest, const Fun& fun, ascii mode) const noexcept -> void
 {
-	return {*this, {rhs}};
-}
+	typedef typename Other::T U;
 
-template <typename Class /* CRTP core */>
-template <typename   LHS, typename   RHS>
-template <size_t                       N> constexpr auto API<Class>::concat<LHS, RHS>::operator+(__16STR__(rhs)) noexcept -> concat<concat, txt<codec<"UTF-16">>>
-{
-	return {*this, {rhs}};
-}
+	const T* head {this->head()};
+	const T* tail {this->tail()};
 
-template <typename Class /* CRTP core */>
-template <typename   LHS, typename   RHS>
-template <size_t                       N> constexpr auto API<Class>::concat<LHS, RHS>::operator+(__32STR__(rhs)) noexcept -> concat<concat, txt<codec<"UTF-32">>>
-{
-	return {*this, {rhs}};
-}
+	// unrelated ptrs can't be compared
+	bool alias {true};
 
-#pragma endregion CRTP::concat
-#pragma region CRTP::const_forward_iterator
+	if !consteval
+	{
+		alias = static_cast<const void*>(head) < static_cast<const void*>(dest.__last__())
+		        &&
+		        static_cast<const void*>(dest.__head__()) < static_cast<const void*>(tail);
+	}
 
-template <typename Class /* CRTP core */> constexpr auto API<Class>::const_forward_iterator::operator*() const noexcept -> value_type
-{
-	char32_t code;
+	const auto fill {[&](str<Other, Arena>& into)
+	{
+		// reuse the buffer; nothing to keep
+		into.__size__(0);
+		into.capacity(static_cast<size_t>(tail - head));
 
-	Codec::decode(this->ptr, code, Codec::next(this->ptr));
+		U* out {into.__head__()};
 
-	return code;
-}
+		// makes room for 'n' more code units; amortized
+		const auto room {[&](size_t n)
+		{
+			const auto size {static_cast<size_t>(out - into.__head__())};
 
-template <typename Class /* CRTP core */> constexpr auto API<Class>::const_forward_iterator::operator++(   ) noexcept -> const_forward_iterator&
-{
-	this->ptr += Codec::next(this->ptr);
+			if (into.capacity() - size < n)
+			{
+				into.__size__(size);
+				into.reserve(size + n);
+				out = into.__head__() + size;
+			}
+		}};
 
-	return *this;
+		for (const T* ptr {head}; ptr < tail; )
+		{
+			if (mode == ascii::KEEP && static_cast<uint32_t>(*ptr) < 0x80)
+			{
+				// 1 code unit in, 1 code unit out; vector kernels copy the run
+				room(static_cast<size_t>(tail - ptr));
+
+				const auto run {detail::__ascii__<Other, Codec>(ptr, tail, out)};
+
+				ptr += run;
+				out += run;
+				continue;
+			}
+
+			char32_t code;
+
+			const auto step {Codec::next(ptr)};
+			Codec::decode(ptr, code, step);
+			ptr += step;
+
+			if constexpr (std::is_convertible_v<std::invoke_result_t<const Fun&, char32_t>, char32_t>)
+			{
+				const char32_t value {fun(code)};
+
+				const auto size {Other::size(value)};
+				room(static_cast<size_t>(size));
+				Other::encode(value, out, size);
+				out += size;
+			}
+			else
+			{
+				[&]<typename 𝒞𝑜𝒹𝑒𝒸>(const txt<𝒞𝑜𝒹𝑒𝒸>& slice)
+				{
+					room(detail::__bound__<Other, 𝒞𝑜𝒹𝑒𝒸>(slice.head(), slice.tail()));
+					out += detail::__fcopy__<Other, 𝒞𝑜𝒹𝑒𝒸>(slice.head(), slice.tail(), out);
+				}
+				(txt {fun(code)});
+			}
+		}
+
+		into.__size__(out - into.__head__());
+		into.__recount__(0, 0);
+	}};
+
+	// writing over the source would clobber what is yet to be read
+	if (alias)
+	{
+		str<Other, Arena> tmp;
+		fill(tmp);
+		dest = std::move(tmp);
+	}
+	else
+	{
+		fill(dest);
+	}
 }
 
-template <typename Class /* CRTP core */> constexpr auto API<Class>::const_forward_iterator::operator++(int) noexcept -> const_forward_iterator
+template <typename Class /* CRTP core */> constexpr auto API<Class>::substr(clamp  start, clamp  until) const noexcept -> txt<Codec>
 {
-	auto clone {*this};
-	operator++();
-	return clone;
+	return detail::__substr__<Codec /*&*/>(this->head(), this->tail(), start, until);
 }
 
-template <typename Class /* CRTP core */> constexpr auto API<Class>::const_forward_iterator::operator--(   ) noexcept -> const_forward_iterator&
+template <typename Class /* CRTP core */> constexpr auto API<Class>::substr(clamp  start, range  until) const noexcept -> txt<Codec>
 {
-	this->ptr += Codec::back(this->ptr);
-
-	return *this;
+	return detail::__substr__<Codec /*&*/>(this->head(), this->tail(), start, until);
 }
 
-template <typename Class /* CRTP core */> constexpr auto API<Class>::const_forward_iterator::operator--(int) noexcept -> const_forward_iterator
+template <typename Class /* CRTP core */> constexpr auto API<Class>::substr(size_t start, clamp  until) const noexcept -> txt<Codec>
 {
-	auto clone {*this};
-	operator--();
-	return clone;
+	if constexpr (!std::is_same_v<Class, txt<Codec>>)
+	{
+		// str; jump to the start by its side index
+		return detail::__substr__<Codec /*&*/>(static_cast<const Class*>(this)->__seek__(start), this->tail(), 0, until);
+	}
+	return detail::__substr__<Codec /*&*/>(this->head(), this->tail(), start, until);
 }
 
-template <typename Class /* CRTP core */> constexpr auto API<Class>::const_forward_iterator::operator+(size_t value) noexcept -> const_forward_iterator
+template <typename Class /* CRTP core */> constexpr auto API<Class>::substr(size_t start, range  until) const noexcept -> txt<Codec>
 {
-	auto clone {*this};
-
-	for (size_t i {0}; i < value; ++i) { ++clone; }
-
-	return clone;
+	if constexpr (!std::is_same_v<Class, txt<Codec>>)
+	{
+		// str; jump to the start by its side index
+		return {static_cast<const Class*>(this)->__seek__(start), this->tail()};
+	}
+	return detail::__substr__<Codec /*&*/>(this->head(), this->tail(), start, until);
 }
 
-template <typename Class /* CRTP core */> constexpr auto API<Class>::const_forward_iterator::operator-(size_t value) noexcept -> const_forward_iterator
+template <typename Class /* CRTP core */> constexpr auto API<Class>::substr(size_t start, size_t until) const noexcept -> txt<Codec>
 {
-	auto clone {*this};
-
-	for (size_t i {0}; i < value; ++i) { --clone; }
+	if constexpr (!std::is_same_v<Class, txt<Codec>>)
+	{
+		assert(start < until);
 
-	return clone;
+		// str; jump to both ends by its side index
+		return {static_cast<const Class*>(this)->__seek__(start), static_cast<const Class*>(this)->__seek__(until)};
+	}
+	return detail::__substr__<Codec /*&*/>(this->head(), this->tail(), start, until);
 }
 
-template <typename Class /* CRTP core */> constexpr auto API<Class>::const_forward_iterator::operator+=(size_t value) noexcept -> const_forward_iterator&
+template <typename Class /* CRTP core */> constexpr auto API<Class>::begin() const noexcept -> const_forward_iterator
 {
-	for (size_t i {0}; i < value; ++i) { ++(*this); }
-
-	return *this;
+	return {this->head()};
 }
 
-template <typename Class /* CRTP core */> constexpr auto API<Class>::const_forward_iterator::operator-=(size_t value) noexcept -> const_forward_iterator&
+template <typename Class /* CRTP core */> constexpr auto API<Class>::end() const noexcept -> const_forward_iterator
 {
-	for (size_t i {0}; i < value; ++i) { --(*this); }
-
-	return *this;
+	return {this->tail()};
 }
 
-#pragma endregion CRTP::const_forward_iterator
-#pragma region CRTP::const_reverse_iterator
-
-template <typename Class /* CRTP core */> constexpr auto API<Class>::const_reverse_iterator::operator*() const noexcept -> value_type
+template <typename Class /* CRTP core */> constexpr auto API<Class>::rbegin() const noexcept -> const_reverse_iterator
 {
-	char32_t code;
-
-	Codec::decode(this->ptr, code, Codec::back(this->ptr));
-
-	return code;
+	return {this->tail()};
 }
 
-template <typename Class /* CRTP core */> constexpr auto API<Class>::const_reverse_iterator::operator++(   ) noexcept -> const_reverse_iterator&
+template <typename Class /* CRTP core */> constexpr auto API<Class>::rend() const noexcept -> const_reverse_iterator
 {
-	this->ptr += Codec::back(this->ptr);
-
-	return *this;
+	return {this->head()};
 }
 
-template <typename Class /* CRTP core */> constexpr auto API<Class>::const_reverse_iterator::operator++(int) noexcept -> const_reverse_iterator
+template <typename Class /* CRTP core */> constexpr auto API<Class>::operator[](size_t value) const noexcept -> decltype(auto)
 {
-	auto clone {*this};
-	operator++();
-	return clone;
+	return typename Class::reader {static_cast<const Class*>(this), value};
 }
 
-template <typename Class /* CRTP core */> constexpr auto API<Class>::const_reverse_iterator::operator--(   ) noexcept -> const_reverse_iterator&
+template <typename Class /* CRTP core */> constexpr auto API<Class>::operator[](size_t value) /*&*/ noexcept -> decltype(auto)
 {
-	this->ptr += Codec::next(this->ptr);
-
-	return *this;
+	return typename Class::writer {static_cast<Class*>(this), value};
 }
 
-template <typename Class /* CRTP core */> constexpr auto API<Class>::const_reverse_iterator::operator--(int) noexcept -> const_reverse_iterator
+template <typename Class /* CRTP core */>
+template <typename Other, typename Arena> constexpr auto API<Class>::operator==(__OWNED__(rhs)) const noexcept -> bool
 {
-	auto clone {*this};
-	operator--();
-	return clone;
+	return detail::__equal__<Codec, Other>(this->head(), this->tail(), rhs.head(), rhs.tail());
 }
 
-template <typename Class /* CRTP core */> constexpr auto API<Class>::const_reverse_iterator::operator+(size_t value) noexcept -> const_reverse_iterator
+template <typename Class /* CRTP core */>
+template <typename Other /* can't own */> constexpr auto API<Class>::operator==(__SLICE__(rhs)) const noexcept -> bool
 {
-	auto clone {*this};
-
-	for (size_t i {0}; i < value; ++i) { ++clone; }
-
-	return clone;
+	return detail::__equal__<Codec, Other>(this->head(), this->tail(), rhs.head(), rhs.tail());
 }
 
-template <typename Class /* CRTP core */> constexpr auto API<Class>::const_reverse_iterator::operator-(size_t value) noexcept -> const_reverse_iterator
+template <typename Class /* CRTP core */>
+template <size_t                       N> constexpr auto API<Class>::operator==(__EQSTR__(rhs)) const noexcept -> bool requires (std::is_same_v<T, char>)
 {
-	auto clone {*this};
-
-	for (size_t i {0}; i < value; ++i) { --clone; }
-
-	return clone;
+	return detail::__equal__<Codec, Codec>(this->head(), this->tail(), &rhs[N - N], &rhs[N - 1]);
 }
 
-template <typename Class /* CRTP core */> constexpr auto API<Class>::const_reverse_iterator::operator+=(size_t value) noexcept -> const_reverse_iterator&
+template <typename Class /* CRTP core */>
+template <size_t                       N> constexpr auto API<Class>::operator==(__08STR__(rhs)) const noexcept -> bool /* encoding of char8_t is trivial */
 {
-	for (size_t i {0}; i < value; ++i) { ++(*this); }
-
-	return *this;
+	return detail::__equal__<Codec, codec<"UTF-8">>(this->head(), this->tail(), &rhs[N - N], &rhs[N - 1]);
 }
 
-template <typename Class /* CRTP core */> constexpr auto API<Class>::const_reverse_iterator::operator-=(size_t value) noexcept -> const_reverse_iterator&
+template <typename Class /* CRTP core */>
+template <size_t                       N> constexpr auto API<Class>::operator==(__16STR__(rhs)) const noexcept -> bool /* encoding of char16_t is trivial */
 {
-	for (size_t i {0}; i < value; ++i) { --(*this); }
-
-	return *this;
+	return detail::__equal__<Codec, codec<"UTF-16">>(this->head(), this->tail(), &rhs[N - N], &rhs[N - 1]);
 }
 
-#pragma endregion CRTP::const_reverse_iterator
-#pragma region CRTP::detail
-
-template <typename Codec> constexpr auto detail::__difcu__(const typename Codec::T* head, const typename Codec::T* tail) noexcept -> size_t
+template <typename Class /* CRTP core */>
+template <size_t                       N> constexpr auto API<Class>::operator==(__32STR__(rhs)) const noexcept -> bool /* encoding of char32_t is trivial */
 {
-	typedef typename Codec::T T;
-
-	if constexpr (Codec::is_variable)
-	{
-		return tail - head;
-	}
+	return detail::__equal__<Codec, codec<"UTF-32">>(this->head(), this->tail(), &rhs[N - N], &rhs[N - 1]);
+}
 
-	if constexpr (!Codec::is_variable)
-	{
-		return tail - head;
-	}
+template <typename Class /* CRTP core */>
+template <typename Other, typename Arena> constexpr auto API<Class>::operator!=(__OWNED__(rhs)) const noexcept -> bool
+{
+	return detail::__nqual__<Codec, Other>(this->head(), this->tail(), rhs.head(), rhs.tail());
 }
 
-template <typename Codec> constexpr auto detail::__difcp__(const typename Codec::T* head, const typename Codec::T* tail) noexcept -> size_t
+template <typename Class /* CRTP core */>
+template <typename Other /* can't own */> constexpr auto API<Class>::operator!=(__SLICE__(rhs)) const noexcept -> bool
 {
-	typedef typename Codec::T T;
+	return detail::__nqual__<Codec, Other>(this->head(), this->tail(), rhs.head(), rhs.tail());
+}
 
-	if constexpr (Codec::is_variable)
-	{
-		size_t out {0};
+template <typename Class /* CRTP core */>
+template <size_t                       N> constexpr auto API<Class>::operator!=(__EQSTR__(rhs)) const noexcept -> bool requires (std::is_same_v<T, char>)
+{
+	return detail::__nqual__<Codec, Codec>(this->head(), this->tail(), &rhs[N - N], &rhs[N - 1]);
+}
 
-		for (const T* ptr {head}; ptr < tail; ++out, ptr += Codec::next(ptr)) {}
+template <typename Class /* CRTP core */>
+template <size_t                       N> constexpr auto API<Class>::operator!=(__08STR__(rhs)) const noexcept -> bool /* encoding of char8_t is trivial */
+{
+	return detail::__nqual__<Codec, codec<"UTF-8">>(this->head(), this->tail(), &rhs[N - N], &rhs[N - 1]);
+}
 
-		return out;
-	}
+template <typename Class /* CRTP core */>
+template <size_t                       N> constexpr auto API<Class>::operator!=(__16STR__(rhs)) const noexcept -> bool /* encoding of char16_t is trivial */
+{
+	return detail::__nqual__<Codec, codec<"UTF-16">>(this->head(), this->tail(), &rhs[N - N], &rhs[N - 1]);
+}
 
-	if constexpr (!Codec::is_variable)
-	{
-		size_t out {0};
+template <typename Class /* CRTP core */>
+template <size_t                       N> constexpr auto API<Class>::operator!=(__32STR__(rhs)) const noexcept -> bool /* encoding of char32_t is trivial */
+{
+	return detail::__nqual__<Codec, codec<"UTF-32">>(this->head(), this->tail(), &rhs[N - N], &rhs[N - 1]);
+}
 
-		for (const T* ptr {head}; ptr < tail; ++out, ptr += Codec::next(ptr)) {}
+template <typename Class /* CRTP core */>
+template <typename Other, typename Arena> constexpr auto API<Class>::operator+(__OWNED__(rhs)) const noexcept -> concat<txt<Codec>, txt<Other>>
+{
+	return {{this->head(), this->tail()}, {rhs.head(), rhs.tail()}};
+}
 
-		return out;
-	}
+template <typename Class /* CRTP core */>
+template <typename Other /* can't own */> constexpr auto API<Class>::operator+(__SLICE__(rhs)) const noexcept -> concat<txt<Codec>, txt<Other>>
+{
+	return {{this->head(), this->tail()}, {rhs.head(), rhs.tail()}};
 }
 
-template <typename Codec,
-          typename Other> constexpr auto detail::__fcopy__(const typename Other::T* head, const typename Other::T* tail,
-                                                                                          /*&*/ typename Codec::T* dest) noexcept -> size_t
+template <typename Class /* CRTP core */>
+template <size_t                       N> constexpr auto API<Class>::operator+(__EQSTR__(rhs)) const noexcept -> concat<txt<Codec>, txt<Codec>> requires (std::is_same_v<T, char>)
 {
-	typedef typename Codec::T T;
-	typedef typename Other::T U;
+	return {{this->head(), this->tail()}, {&rhs[N - N], &rhs[N - 1]}};
+}
 
-	if constexpr (std::is_same_v<Codec, Other>)
-	{
-		std::ranges::copy/*forward*/
-		(
-			head,
-			tail,
-			dest
-		);
+template <typename Class /* CRTP core */>
+template <size_t                       N> constexpr auto API<Class>::operator+(__08STR__(rhs)) const noexcept -> concat<txt<Codec>, txt<codec<"UTF-8">>> /* encoding of char8_t is trivial */
+{
+	return {{this->head(), this->tail()}, {&rhs[N - N], &rhs[N - 1]}};
+}
 
-		return __difcu__<Codec>(head, tail);
-	}
+template <typename Class /* CRTP core */>
+template <size_t                       N> constexpr auto API<Class>::operator+(__16STR__(rhs)) const noexcept -> concat<txt<Codec>, txt<codec<"UTF-16">>> /* encoding of char16_t is trivial */
+{
+	return {{this->head(), this->tail()}, {&rhs[N - N], &rhs[N - 1]}};
+}
 
-	if constexpr (!std::is_same_v<Codec, Other>)
-	{
-		T* out {dest};
+template <typename Class /* CRTP core */>
+template <size_t                       N> constexpr auto API<Class>::operator+(__32STR__(rhs)) const noexcept -> concat<txt<Codec>, txt<codec<"UTF-32">>> /* encoding of char32_t is trivial */
+{
+	return {{this->head(), this->tail()}, {&rhs[N - N], &rhs[N - 1]}};
+}
 
-		// for (const U* ptr {head}; ptr < tail; )
-		// {
-		// 	char32_t code;
+#pragma endregion CRTP
+#pragma region CRTP::concat
 
-		// 	const auto U_step {Other::next(ptr)};
-		// 	Other::decode(ptr, code, U_step);
-		// 	const auto T_step {Codec::size(code)};
+template <typename Class /* CRTP core */>
+template <typename   LHS, typename   RHS>
+template <typename Other, typename Arena> constexpr API<Class>::concat<LHS, RHS>::operator str<Other, Arena>() const noexcept
+{
+	str<Other, Arena> out;
 
-		// 	ptr += U_step;
-		// 	out += T_step;
-		// }
+	if constexpr (std::is_same_v<decltype(this->__donor__()), str<Other, Arena>*>)
+	{
+		const auto donor {this->__donor__()};
 
-		for (const U* ptr {head}; ptr < tail; )
+		// steal the buffer, unless the other chunks read from it
+		if (!this->__alias__(*donor, donor))
 		{
-			char32_t code;
-
-			const auto U_step {Other::next(ptr)};
-			Other::decode(ptr, code, U_step);
-			const auto T_step {Codec::size(code)};
-			Codec::encode(code, out, T_step);
-
-			ptr += U_step;
-			out += T_step;
+			out = std::move(*donor);
 		}
-
-		return __difcu__<Codec>(dest, out);
 	}
+
+	this->__append__(out);
+
+	return out;
 }
 
-template <typename Codec,
-          typename Other> constexpr auto detail::__rcopy__(const typename Other::T* head, const typename Other::T* tail,
-                                                                                          /*&*/ typename Codec::T* dest) noexcept -> size_t
+template <typename Class /* CRTP core */>
+template <typename   LHS, typename   RHS> constexpr auto API<Class>::concat<LHS, RHS>::__for_each__(const auto& fun) const noexcept -> void
 {
-	typedef typename Codec::T T;
-	typedef typename Other::T U;
+	if constexpr (requires(LHS l) { l.__for_each__(fun); })
+	{ this->lhs.__for_each__(fun); } else { fun(this->lhs); }
 
-	if constexpr (std::is_same_v<Codec, Other>)
-	{
-		std::ranges::copy_backward
-		(
-			head,
-			tail,
-			dest
-		);
+	if constexpr (requires(RHS r) { r.__for_each__(fun); })
+	{ this->rhs.__for_each__(fun); } else { fun(this->rhs); }
+}
 
-		return __difcu__<Codec>(head, tail);
+template <typename Class /* CRTP core */>
+template <typename   LHS, typename   RHS> constexpr auto API<Class>::concat<LHS, RHS>::__donor__() const noexcept -> auto
+{
+	/**/ if constexpr (requires(LHS l) { l.__donor__(); })
+	{
+		return this->lhs.__donor__();
 	}
-
-	if constexpr (!std::is_same_v<Codec, Other>)
+	else if constexpr (std::is_rvalue_reference_v<LHS>)
 	{
-		T* out {dest};
-
-		for (const U* ptr {head}; ptr < tail; )
-		{
-			char32_t code;
+		return &this->lhs;
+	}
+	else
+	{
+		return nullptr;
+	}
+}
 
-			const auto U_step {Other::next(ptr)};
-			Other::decode(ptr, code, U_step);
-			const auto T_step {Codec::size(code)};
+template <typename Class /* CRTP core */>
+template <typename   LHS, typename   RHS>
+template <typename Other, typename Arena> constexpr auto API<Class>::concat<LHS, RHS>::__alias__(const str<Other, Arena>& dest, const void* skip) const noexcept -> bool
+{
+	// unrelated ptrs can't be compared
+	if consteval { return true; }
 
-			ptr += U_step;
-			out += T_step;
-		}
+	bool out {false};
 
-		for (const U* ptr {tail}; head < ptr; )
+	this->__for_each__([&](auto&& chunk)
+	{
+		if (static_cast<const void*>(&chunk) != skip)
 		{
-			char32_t code;
-
-			const auto U_step {Other::back(ptr)};
-			Other::decode(ptr, code, U_step);
-			const auto T_step {Codec::size(code)};
-			Codec::encode(code, out, T_step);
-
-			ptr += U_step;
-			out += T_step;
+			[&]<typename 𝒞𝑜𝒹𝑒𝒸>(const txt<𝒞𝑜𝒹𝑒𝒸>& slice)
+			{
+				if constexpr (std::is_same_v<typename Other::T, typename 𝒞𝑜𝒹𝑒𝒸::T>)
+				{
+					out |= slice.head() < dest.__last__() && dest.__head__() < slice.tail();
+				}
+			}
+			(txt {chunk});
 		}
+	});
 
-		return __difcu__<Codec>(dest, out);
-	}
+	return out;
 }
 
-template <typename Codec,
-          typename Other> constexpr auto detail::__equal__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
-                                                           const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> bool
+template <typename Class /* CRTP core */>
+template <typename   LHS, typename   RHS>
+template <typename Other, typename Arena> constexpr auto API<Class>::concat<LHS, RHS>::__append__(/*&*/ str<Other, Arena>& dest) const noexcept -> void
 {
-	typedef typename Codec::T T;
-	typedef typename Other::T U;
+	typedef typename Other::T T;
 
-	if constexpr (std::is_same_v<Codec, Other>)
+	size_t size {dest.size()};
+
+	const auto prev {dest.__length__()};
+	const auto from {dest.size()};
+
+	this->__for_each__([&](auto&& chunk)
 	{
-		if (lhs_0 == rhs_0
-		    &&
-		    lhs_N == rhs_N)
+		[&]<typename 𝒞𝑜𝒹𝑒𝒸>(const txt<𝒞𝑜𝒹𝑒𝒸>& slice)
 		{
-			return true;
+			size += detail::__bound__<Other, 𝒞𝑜𝒹𝑒𝒸>(slice.head(), slice.tail());
 		}
+		(txt {chunk});
+	});
 
-		return __difcu__<Codec>(lhs_0, lhs_N)
-		       ==
-		       __difcu__<Other>(rhs_0, rhs_N)
-		       &&
-		       std::ranges::equal(lhs_0, lhs_N, rhs_0, rhs_N);
-	}
+	// a buffer already large enough is reused as is
+	const auto alloc {dest.capacity() < size};
 
-	if constexpr (!std::is_same_v<Codec, Other>)
-	{
-		const T* lhs_ptr {lhs_0};
-		const U* rhs_ptr {rhs_0};
+	// room for the worst case, then transcode once; amortized
+	dest.reserve(size);
 
-		for (; lhs_ptr < lhs_N && rhs_ptr < rhs_N; )
-		{
-			char32_t T_code;
-			char32_t U_code;
+	T* ptr {dest.__tail__()};
 
-			const auto T_step {Codec::next(lhs_ptr)};
-			const auto U_step {Other::next(rhs_ptr)};
+	this->__for_each__([&](auto&& chunk)
+	{
+		[&]<typename 𝒞𝑜𝒹𝑒𝒸>(const txt<𝒞𝑜𝒹𝑒𝒸>& slice)
+		{
+			ptr += detail::__fcopy__<Other, 𝒞𝑜𝒹𝑒𝒸>(slice.head(), slice.tail(), ptr);
+		}
+		(txt {chunk});
+	});
 
-			Codec::decode(lhs_ptr, T_code, T_step);
-			Other::decode(rhs_ptr, U_code, U_step);
+	dest.__size__(ptr - dest.__head__());
 
-			if (T_code != U_code)
-			{
-				return false;
-			}
+	if (alloc) { dest.__trim__(); }
 
-			lhs_ptr += T_step;
-			rhs_ptr += U_step;
-		}
+	dest.__recount__(prev, from);
+}
 
-		return lhs_ptr == lhs_N && rhs_ptr == rhs_N;
+template <typename Class /* CRTP core */>
+template <typename   LHS, typename   RHS>
+template <typename Other, typename Arena> constexpr auto API<Class>::concat<LHS, RHS>::__assign__(/*&*/ str<Other, Arena>& dest) const noexcept -> void
+{
+	// overwriting 'dest' would clobber the chunks that view it
+	if (this->__alias__(dest, nullptr))
+	{
+		dest = static_cast<str<Other, Arena>>(*this);
+	}
+	else
+	{
+		// reuse the buffer; nothing to keep
+		dest.__size__(0);
+		this->__append__(dest);
 	}
 }
 
-template <typename Codec,
-          typename Other> constexpr auto detail::__nqual__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
-                                                           const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> bool
+template <typename Class /* CRTP core */>
+template <typename   LHS, typename   RHS>
+template <typename Other, typename Arena> constexpr auto API<Class>::concat<LHS, RHS>::__concat__(/*&*/ str<Other, Arena>& dest) const noexcept -> void
 {
-	typedef typename Codec::T T;
-	typedef typename Other::T U;
-
-	if constexpr (std::is_same_v<Codec, Other>)
+	// growing 'dest' would invalidate the chunks that view it
+	if (this->__alias__(dest, nullptr))
 	{
-		if (lhs_0 == rhs_0
-		    &&
-		    lhs_N == rhs_N)
-		{
-			return false;
-		}
-
-		return __difcu__<Codec>(lhs_0, lhs_N)
-		       !=
-		       __difcu__<Other>(rhs_0, rhs_N)
-		       ||
-		       !std::ranges::equal(lhs_0, lhs_N, rhs_0, rhs_N);
+		str<Other, Arena> tmp;
+		this->__append__(tmp);
+		dest += tmp;
 	}
-
-	if constexpr (!std::is_same_v<Codec, Other>)
+	else
 	{
-		const T* lhs_ptr {lhs_0};
-		const U* rhs_ptr {rhs_0};
+		this->__append__(dest);
+	}
+}
 
-		for (; lhs_ptr < lhs_N && rhs_ptr < rhs_N; )
-		{
-			char32_t T_code;
-			char32_t U_code;
+template <typename Class /* CRTP core */>
+template <typename   LHS, typename   RHS>
+template <typename Other, typename Arena> constexpr auto API<Class>::concat<LHS, RHS>::operator=(__OWNED__(rhs)) noexcept -> concat<blank_t, txt<Other>>
+{
+	return {{""}, {rhs}};
+}
 
-			const auto T_step {Codec::next(lhs_ptr)};
-			const auto U_step {Other::next(rhs_ptr)};
+template <typename Class /* CRTP core */>
+template <typename   LHS, typename   RHS>
+template <typename Other /* can't own */> constexpr auto API<Class>::concat<LHS, RHS>::operator=(__SLICE__(rhs)) noexcept -> concat<blank_t, txt<Other>>
+{
+	return {{""}, {rhs}};
+}
 
-			Codec::decode(lhs_ptr, T_code, T_step);
-			Other::decode(rhs_ptr, U_code, U_step);
+template <typename Class /* CRTP core */>
+template <typename   LHS, typename   RHS>
+template <size_t                       N> constexpr auto API<Class>::concat<LHS, RHS>::operator=(__08STR__(rhs)) noexcept -> concat<blank_t, txt<codec<"UTF-8">>>
+{
+	return {{""}, {rhs}};
+}
 
-			if (T_code != U_code)
-			{
-				return true;
-			}
+template <typename Class /* CRTP core */>
+template <typename   LHS, typename   RHS>
+template <size_t                       N> constexpr auto API<Class>::concat<LHS, RHS>::operator=(__16STR__(rhs)) noexcept -> concat<blank_t, txt<codec<"UTF-16">>>
+{
+	return {{""}, {rhs}};
+}
 
-			lhs_ptr += T_step;
-			rhs_ptr += U_step;
-		}
+template <typename Class /* CRTP core */>
+template <typename   LHS, typename   RHS>
+template <size_t                       N> constexpr auto API<Class>::concat<LHS, RHS>::operator=(__32STR__(rhs)) noexcept -> concat<blank_t, txt<codec<"UTF-32">>>
+{
+	return {{""}, {rhs}};
+}
 
-		return lhs_ptr != lhs_N || rhs_ptr != rhs_N;
-	}
+template <typename Class /* CRTP core */>
+template <typename   LHS, typename   RHS>
+template <typename Other, typename Arena> constexpr auto API<Class>::concat<LHS, RHS>::operator+(__OWNED__(rhs)) noexcept -> concat<concat, txt<Other>>
+{
+	return {*this, {rhs}};
 }
 
-template <typename Codec,
-          typename Other> constexpr auto detail::__swith__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
-                                                           const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> bool
+template <typename Class /* CRTP core */>
+template <typename   LHS, typename   RHS>
+template <typename Other /* can't own */> constexpr auto API<Class>::concat<LHS, RHS>::operator+(__SLICE__(rhs)) noexcept -> concat<concat, txt<Other>>
 {
-	typedef typename Codec::T T;
-	typedef typename Other::T U;
+	return {*this, {rhs}};
+}
 
-	if constexpr (std::is_same_v<Codec, Other>)
+template <typename Class /* CRTP core */>
+template <typename   LHS, typename   RHS>
+template <size_t                       N> constexpr auto API<Class>::concat<LHS, RHS>::operator+(__08STR__(rhs)) noexcept -> concat<concat, txt<codec<"UTF-8">>>
+{
+	return {*this, {rhs}};
+}
+
+template <typename Class /* CRTP core */>
+template <typename   LHS, typename   RHS>
+template <size_t                       N> constexpr auto API<Class>::concat<LHS, RHS>::operator+(__16STR__(rhs)) noexcept -> concat<concat, txt<codec<"UTF-16">>>
+{
+	return {*this, {rhs}};
+}
+
+template <typename Class /* CRTP core */>
+template <typename   LHS, typename   RHS>
+template <size_t                       N> constexpr auto API<Class>::concat<LHS, RHS>::operator+(__32STR__(rhs)) noexcept -> concat<concat, txt<codec<"UTF-32">>>
+{
+	return {*this, {rhs}};
+}
+
+#pragma endregion CRTP::concat
+#pragma region CRTP::const_forward_iterator
+
+template <typename Class /* CRTP core */> constexpr auto API<Class>::const_forward_iterator::operator*() const noexcept -> reference
+{
+	if constexpr (SOLID)
 	{
-		if (lhs_0 == rhs_0
-		    &&
-		    lhs_N == rhs_N)
-		{
-			return true;
-		}
+		return *this->ptr;
+	}
+	else
+	{
+		char32_t code;
 
-		const auto lhs_len {__difcu__<Codec>(lhs_0, lhs_N)};
-		const auto rhs_len {__difcu__<Other>(rhs_0, rhs_N)};
+		Codec::decode(this->ptr, code, Codec::next(this->ptr));
 
-		return rhs_len == 0 // if rhs(delimeter) is an empty string (e.g. str.starts_with(""))
-		       ||
-		       (lhs_len >= rhs_len && std::ranges::equal(lhs_0, lhs_0 + rhs_len, rhs_0, rhs_N));
+		return code;
 	}
+}
 
-	if constexpr (!std::is_same_v<Codec, Other>)
-	{
-		const T* lhs_ptr {lhs_0};
-		const U* rhs_ptr {rhs_0};
+template <typename Class /* CRTP core */> constexpr auto API<Class>::const_forward_iterator::operator->() const noexcept -> const T* requires (SOLID)
+{
+	return this->ptr;
+}
 
-		for (; lhs_ptr < lhs_N && rhs_ptr < rhs_N; )
-		{
-			char32_t T_code;
-			char32_t U_code;
+template <typename Class /* CRTP core */> constexpr auto API<Class>::const_forward_iterator::operator[](difference_type value) const noexcept -> reference requires (FIXED)
+{
+	return *(*this + value);
+}
 
-			const auto T_step {Codec::next(lhs_ptr)};
-			const auto U_step {Other::next(rhs_ptr)};
+template <typename Class /* CRTP core */> constexpr auto API<Class>::const_forward_iterator::operator++(   ) noexcept -> const_forward_iterator&
+{
+	this->ptr += Codec::next(this->ptr);
 
-			Codec::decode(lhs_ptr, T_code, T_step);
-			Other::decode(rhs_ptr, U_code, U_step);
+	return *this;
+}
 
-			if (T_code != U_code)
-			{
-				return false;
-			}
+template <typename Class /* CRTP core */> constexpr auto API<Class>::const_forward_iterator::operator++(int) noexcept -> const_forward_iterator
+{
+	auto clone {*this};
+	operator++();
+	return clone;
+}
 
-			lhs_ptr += T_step;
-			rhs_ptr += U_step;
-		}
+template <typename Class /* CRTP core */> constexpr auto API<Class>::const_forward_iterator::operator--(   ) noexcept -> const_forward_iterator&
+{
+	this->ptr += Codec::back(this->ptr);
 
-		return rhs_ptr == rhs_N;
-	}
+	return *this;
 }
 
-template <typename Codec,
-          typename Other> constexpr auto detail::__ewith__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
-                                                           const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> bool
+template <typename Class /* CRTP core */> constexpr auto API<Class>::const_forward_iterator::operator--(int) noexcept -> const_forward_iterator
 {
-	typedef typename Codec::T T;
-	typedef typename Other::T U;
+	auto clone {*this};
+	operator--();
+	return clone;
+}
 
-	if constexpr (std::is_same_v<Codec, Other>)
-	{
-		if (lhs_0 == rhs_0
-		    &&
-		    lhs_N == rhs_N)
-		{
-			return true;
-		}
+template <typename Class /* CRTP core */> constexpr auto API<Class>::const_forward_iterator::operator+(difference_type value) const noexcept -> const_forward_iterator
+{
+	auto clone {*this};
+	clone += value;
+	return clone;
+}
 
-		const auto lhs_len {__difcu__<Codec>(lhs_0, lhs_N)};
-		const auto rhs_len {__difcu__<Other>(rhs_0, rhs_N)};
+template <typename Class /* CRTP core */> constexpr auto API<Class>::const_forward_iterator::operator-(difference_type value) const noexcept -> const_forward_iterator
+{
+	auto clone {*this};
+	clone -= value;
+	return clone;
+}
 
-		return rhs_len == 0 // if rhs(delimeter) is an empty string (e.g. str.ends_with(""))
-		       ||
-		       (lhs_len >= rhs_len && std::ranges::equal(lhs_N - rhs_len, lhs_N, rhs_0, rhs_N));
+template <typename Class /* CRTP core */> constexpr auto API<Class>::const_forward_iterator::operator+=(difference_type value) noexcept -> const_forward_iterator&
+{
+	if constexpr (FIXED)
+	{
+		// one code unit per code point
+		this->ptr += value;
 	}
-
-	if constexpr (!std::is_same_v<Codec, Other>)
+	else
 	{
-		const T* lhs_ptr {lhs_N};
-		const U* rhs_ptr {rhs_N};
+		for (; 0 < value; --value) { ++(*this); }
+		for (; value < 0; ++value) { --(*this); }
+	}
+	return *this;
+}
 
-		for (; lhs_0 < lhs_ptr && rhs_0 < rhs_ptr; )
-		{
-			char32_t T_code;
-			char32_t U_code;
+template <typename Class /* CRTP core */> constexpr auto API<Class>::const_forward_iterator::operator-=(difference_type value) noexcept -> const_forward_iterator&
+{
+	return this->operator+=(-value);
+}
 
-			const auto T_step {Codec::back(lhs_ptr)};
-			const auto U_step {Other::back(rhs_ptr)};
+template <typename Class /* CRTP core */> constexpr auto API<Class>::const_forward_iterator::operator-(const const_forward_iterator& rhs) const noexcept -> difference_type requires (FIXED)
+{
+	return this->ptr - rhs.ptr;
+}
 
-			Codec::decode(lhs_ptr, T_code, T_step);
-			Other::decode(rhs_ptr, U_code, U_step);
+template <typename Class /* CRTP core */> constexpr auto API<Class>::const_forward_iterator::operator<=>(const const_forward_iterator& rhs) const noexcept -> std::strong_ordering requires (FIXED)
+{
+	return this->ptr <=> rhs.ptr;
+}
 
-			if (T_code != U_code)
-			{
-				return false;
-			}
+#pragma endregion CRTP::const_forward_iterator
+#pragma region CRTP::const_reverse_iterator
 
-			lhs_ptr += T_step;
-			rhs_ptr += U_step;
-		}
+template <typename Class /* CRTP core */> constexpr auto API<Class>::const_reverse_iterator::operator*() const noexcept -> value_type
+{
+	char32_t code;
 
-		return rhs_ptr == rhs_0;
-	}
+	Codec::decode(this->ptr, code, Codec::back(this->ptr));
+
+	return code;
 }
 
-template <typename Codec,
-          typename Other> constexpr auto detail::__scan__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
-                                                          const typename Other::T* rhs_0, const typename Other::T* rhs_N,
-                                                                                          const auto& fun /* lambda E */) noexcept -> void
+template <typename Class /* CRTP core */> constexpr auto API<Class>::const_reverse_iterator::operator[](difference_type value) const noexcept -> value_type requires (FIXED)
 {
-	typedef typename Codec::T T;
-	typedef typename Other::T U;
+	return *(*this + value);
+}
 
-	if constexpr (std::is_same_v<Codec, Other>)
-	{
-		const auto lhs_len {__difcu__<Codec>(lhs_0, lhs_N)};
-		const auto rhs_len {__difcu__<Other>(rhs_0, rhs_N)};
+template <typename Class /* CRTP core */> constexpr auto API<Class>::const_reverse_iterator::operator++(   ) noexcept -> const_reverse_iterator&
+{
+	this->ptr += Codec::back(this->ptr);
 
-		if (0 < lhs_len && 0 < rhs_len)
-		{
-			if (lhs_len == rhs_len)
-			{
-				if (lhs_0 == rhs_0
-				    &&
-				    lhs_N == rhs_N)
-				{
-					fun(lhs_0, lhs_N);
-				}
-				else if (__equal__<Codec, Other>(lhs_0, lhs_N,
-				                                 rhs_0, rhs_N))
-				{
-					fun(lhs_0, lhs_N);
-				}
-			}
-			else if (lhs_len < rhs_len)
-			{
-				// nothing to do...
-			}
-			else if (lhs_len > rhs_len)
-			{
-				const T* anchor;
-
-				std::vector<size_t> tbl (rhs_len, 0);
-				// std::vector<char32_t> rhs (rhs_len, 0);
+	return *this;
+}
 
-				// uint32_t step;
-				size_t i;
-				size_t j;
-				// char32_t code;
+template <typename Class /* CRTP core */> constexpr auto API<Class>::const_reverse_iterator::operator++(int) noexcept -> const_reverse_iterator
+{
+	auto clone {*this};
+	operator++();
+	return clone;
+}
 
-				i = 0;
-				j = 0;
+template <typename Class /* CRTP core */> constexpr auto API<Class>::const_reverse_iterator::operator--(   ) noexcept -> const_reverse_iterator&
+{
+	this->ptr += Codec::next(this->ptr);
 
-				for (const U* ptr {rhs_0}; ptr < rhs_N; ++ptr, ++i)
-				{
-					// step = Other::next(ptr);
+	return *this;
+}
 
-					// Other::decode(ptr, rhs[i], step);
+template <typename Class /* CRTP core */> constexpr auto API<Class>::const_reverse_iterator::operator--(int) noexcept -> const_reverse_iterator
+{
+	auto clone {*this};
+	operator--();
+	return clone;
+}
 
-					while (0 < j && rhs_0[i] != rhs_0[j])
-					{
-						j = tbl[j - 1];
-					}
+template <typename Class /* CRTP core */> constexpr auto API<Class>::const_reverse_iterator::operator+(difference_type value) const noexcept -> const_reverse_iterator
+{
+	auto clone {*this};
+	clone += value;
+	return clone;
+}
 
-					if /* match */ (rhs_0[i] == rhs_0[j])
-					{
-						tbl[i] = ++j;
-					}
-				}
+template <typename Class /* CRTP core */> constexpr auto API<Class>::const_reverse_iterator::operator-(difference_type value) const noexcept -> const_reverse_iterator
+{
+	auto clone {*this};
+	clone -= value;
+	return clone;
+}
 
-				i = 0;
-				j = 0;
+template <typename Class /* CRTP core */> constexpr auto API<Class>::const_reverse_iterator::operator+=(difference_type value) noexcept -> const_reverse_iterator&
+{
+	if constexpr (FIXED)
+	{
+		// one code unit per code point
+		this->ptr -= value;
+	}
+	else
+	{
+		for (; 0 < value; --value) { ++(*this); }
+		for (; value < 0; ++value) { --(*this); }
+	}
+	return *this;
+}
 
-				for (const T* ptr {lhs_0}; ptr < lhs_N; ++ptr, ++i)
-				{
-					// step = Codec::next(ptr);
+template <typename Class /* CRTP core */> constexpr auto API<Class>::const_reverse_iterator::operator-=(difference_type value) noexcept -> const_reverse_iterator&
+{
+	return this->operator+=(-value);
+}
 
-					// Codec::decode(ptr, code, step);
+template <typename Class /* CRTP core */> constexpr auto API<Class>::const_reverse_iterator::operator-(const const_reverse_iterator& rhs) const noexcept -> difference_type requires (FIXED)
+{
+	return rhs.ptr - this->ptr;
+}
 
-					while (0 < j && *ptr != rhs_0[j])
-					{
-						j = tbl[j - 1];
-					}
+template <typename Class /* CRTP core */> constexpr auto API<Class>::const_reverse_iterator::operator<=>(const const_reverse_iterator& rhs) const noexcept -> std::strong_ordering requires (FIXED)
+{
+	return rhs.ptr <=> this->ptr;
+}
 
-					if /* match */ (*ptr == rhs_0[j])
-					{
-						if (j == (  0  ))
-						{
-							// store ptr
-							anchor = ptr; // <- 1st unit pos
-						}
+#pragma endregion CRTP::const_reverse_iterator
+#pragma region SIMD::SSE42
 
-						++j;
+#if X86_64
 
-						if (j == rhs_len)
-						{
-							// flush ptr
-							fun(anchor, ptr + 1); j = 0;
-						}
-					}
-				}
-			}
-		}
-	}
-	
-	if constexpr (!std::is_same_v<Codec, Other>)
+namespace detail::sse42
+{
+	// widens/narrows ASCII code units, 16 per iteration; returns the number of units copied.
+	template <typename T, typename U> TARGET(SSE42) static inline auto __ascii__(const U* head, const U* tail, T* dest) noexcept -> size_t
 	{
-		const auto lhs_len {__difcp__<Codec>(lhs_0, lhs_N)};
-		const auto rhs_len {__difcp__<Other>(rhs_0, rhs_N)};
+		const U* ptr {head};
 
-		if (0 < lhs_len && 0 < rhs_len)
+		for (; 16 <= tail - ptr; ptr += 16, dest += 16)
 		{
-			if (lhs_len == rhs_len)
+			__m128i bytes;
+
+			if constexpr (sizeof(U) == 1)
 			{
-				// if (lhs_0 == rhs_0
-				//     &&
-				//     lhs_N == rhs_N)
-				// {
-				// 	fun(lhs_0, lhs_N);
-				// }
-				/* else */ if (__equal__<Codec, Other>(lhs_0, lhs_N,
-				                                       rhs_0, rhs_N))
-				{
-					fun(lhs_0, lhs_N);
-				}
+				bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + 0));
+
+				if (_mm_movemask_epi8(bytes) != 0) break;
 			}
-			else if (lhs_len < rhs_len)
+			if constexpr (sizeof(U) == 2)
 			{
-				// nothing to do...
+				const __m128i a {_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + 0))};
+				const __m128i b {_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + 8))};
+
+				if (!_mm_testz_si128(_mm_or_si128(a, b), _mm_set1_epi16(static_cast<int16_t>(0xFF80)))) break;
+
+				bytes = _mm_packus_epi16(a, b);
 			}
-			else if (lhs_len > rhs_len)
+			if constexpr (sizeof(U) == 4)
 			{
-				const T* anchor;
-
-				std::vector<size_t> tbl (rhs_len, 0);
-				std::vector<char32_t> rhs (rhs_len, 0);
+				const __m128i a {_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + 0x0))};
+				const __m128i b {_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + 0x4))};
+				const __m128i c {_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + 0x8))};
+				const __m128i d {_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + 0xC))};
 
-				uint32_t step;
-				size_t i;
-				size_t j;
-				char32_t code;
+				if (!_mm_testz_si128(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)), _mm_set1_epi32(static_cast<int32_t>(0xFFFFFF80)))) break;
 
-				i = 0;
-				j = 0;
+				bytes = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+			}
 
-				for (const U* ptr {rhs_0}; ptr < rhs_N; ptr += step, ++i)
-				{
-					step = Other::next(ptr);
+			if constexpr (sizeof(T) == 1)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + 0), bytes);
+			}
+			if constexpr (sizeof(T) == 2)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + 0), _mm_cvtepu8_epi16(bytes));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + 8), _mm_cvtepu8_epi16(_mm_srli_si128(bytes, 8)));
+			}
+			if constexpr (sizeof(T) == 4)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + 0x0), _mm_cvtepu8_epi32(bytes));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + 0x4), _mm_cvtepu8_epi32(_mm_srli_si128(bytes, 0x4)));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + 0x8), _mm_cvtepu8_epi32(_mm_srli_si128(bytes, 0x8)));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + 0xC), _mm_cvtepu8_epi32(_mm_srli_si128(bytes, 0xC)));
+			}
+		}
+		return ptr - head;
+	}
 
-					Other::decode(ptr, rhs[i], step);
+	// pshufb masks that left-pack the 16-bit lanes selected by an 8-bit mask.
+	static constexpr const auto __pack16__ {[]() consteval
+	{
+		struct { uint8_t mask[256][16]; } out {};
 
-					while (0 < j && rhs[i] != rhs[j])
-					{
-						j = tbl[j - 1];
-					}
+		for (uint16_t keep {0}; keep < 256; ++keep)
+		{
+			uint8_t i {0};
 
-					if /* match */ (rhs[i] == rhs[j])
-					{
-						tbl[i] = ++j;
-					}
+			for (uint8_t lane {0}; lane < 8; ++lane)
+			{
+				if (keep & (1 << lane))
+				{
+					out.mask[keep][i++] = 2 * lane + 0;
+					out.mask[keep][i++] = 2 * lane + 1;
 				}
+			}
+			for (; i < 16; ++i) out.mask[keep][i] = 0x80;
+		}
+		return out;
+	}()};
 
-				i = 0;
-				j = 0;
+	// decodes the sequences starting at data[0...7] into 8 code units; pair marks the lanes
+	// that follow a 4-byte lead, which then hold its low surrogate instead of a continuation.
+	TARGET(SSE42) static inline auto __decode16__(const char8_t* data, uint32_t pair) noexcept -> __m128i
+	{
+		const __m128i b0 {_mm_cvtepu8_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(data + 0)))};
+		const __m128i b1 {_mm_and_si128(_mm_cvtepu8_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(data + 1))), _mm_set1_epi16(0x3F))};
+		const __m128i b2 {_mm_and_si128(_mm_cvtepu8_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(data + 2))), _mm_set1_epi16(0x3F))};
 
-				for (const T* ptr {lhs_0}; ptr < lhs_N; ptr += step, ++i)
-				{
-					step = Codec::next(ptr);
+		//┌────────────────────────────────────────────────────┐
+		//│ 0xxxxxxx                            -> 1 code unit │
+		//│ 110xxxxx 10xxxxxx                   -> 1 code unit │
+		//│ 1110xxxx 10xxxxxx 10xxxxxx          -> 1 code unit │
+		//│ 11110xxx 10xxxxxx 10xxxxxx 10xxxxxx -> 2 code unit │
+		//└────────────────────────────────────────────────────┘
 
-					Codec::decode(ptr, code, step);
+		// the 16-bit shift drops what is left of the lead's prefix
+		const __m128i c2 {_mm_or_si128(_mm_slli_epi16(_mm_and_si128(b0, _mm_set1_epi16(0x1F)), 6), b1)};
+		const __m128i c3 {_mm_or_si128(_mm_or_si128(_mm_slli_epi16(b0, 12), _mm_slli_epi16(b1, 6)), b2)};
 
-					while (0 < j && code != rhs[j])
-					{
-						j = tbl[j - 1];
-					}
+		const __m128i hi {_mm_or_si128(_mm_sub_epi16(_mm_or_si128(_mm_or_si128(_mm_slli_epi16(_mm_and_si128(b0, _mm_set1_epi16(0x07)), 8),
+		                                                                       _mm_slli_epi16(b1, 2)),
+		                                                          _mm_srli_epi16(b2, 4)),
+		                                             _mm_set1_epi16(0x40)),
+		                               _mm_set1_epi16(static_cast<int16_t>(0xD800)))};
 
-					if /* match */ (code == rhs[j])
-					{
-						if (j == (  0  ))
-						{
-							// store ptr
-							anchor = ptr; // <- 1st code pos
-						}
+		const __m128i lo {_mm_or_si128(_mm_or_si128(_mm_slli_epi16(_mm_and_si128(b1, _mm_set1_epi16(0x0F)), 6), b2),
+		                               _mm_set1_epi16(static_cast<int16_t>(0xDC00)))};
 
-						++j;
+		const __m128i bit {_mm_setr_epi16(0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80)};
 
-						if (j == rhs_len)
-						{
-							// flush ptr
-							fun(anchor, ptr + step); j = 0;
-						}
-					}
-				}
-			}
-		}
-	}
-}
+		__m128i code {b0};
 
-template <typename Codec,
-          typename Other> constexpr auto detail::__split__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
-	                                                       const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> std::vector<txt<Codec>>
-{
-	typedef typename Codec::T T;
-	typedef typename Other::T U;
+		code = _mm_blendv_epi8(code, c2, _mm_cmpgt_epi16(b0, _mm_set1_epi16(0x7F)));
+		code = _mm_blendv_epi8(code, c3, _mm_cmpgt_epi16(b0, _mm_set1_epi16(0xDF)));
+		code = _mm_blendv_epi8(code, hi, _mm_cmpgt_epi16(b0, _mm_set1_epi16(0xEF)));
+		code = _mm_blendv_epi8(code, lo, _mm_cmpeq_epi16(_mm_and_si128(_mm_set1_epi16(static_cast<int16_t>(pair)), bit), bit));
 
-	std::vector<txt<Codec>> out;
+		return code;
+	}
 
-	const T* last {lhs_0};
+	// gathers the sign bits of 2 vectors of bytes into one mask.
+	TARGET(SSE42) static inline auto __mask__(__m128i a, __m128i b) noexcept -> uint32_t
+	{
+		return static_cast<uint32_t>(_mm_movemask_epi8(a))
+		       |
+		       static_cast<uint32_t>(_mm_movemask_epi8(b)) << 16;
+	}
 
-	__scan__<Codec, Other>(lhs_0, lhs_N,
-	                       rhs_0, rhs_N,
-		// on every distinct match found
-		[&](const T* head, const T* tail)
+	// transcodes well-formed UTF-8, 16 bytes per iteration; stops at the first malformed block.
+	TARGET(SSE42) static inline auto __utf8to16__(const char8_t*& head, const char8_t* tail, char16_t*& dest) noexcept -> void
+	{
+		const char8_t* ptr {head};
+		/*&*/ char16_t* out {dest};
+
+		// the lookahead reads up to 32 bytes, and every store stays within the output
+		// of the bytes left, which are at least a quarter of them in code units
+		for (; 64 <= tail - ptr; )
 		{
-			if (head != last)
+			const __m128i a {_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + 0x00))};
+			const __m128i b {_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + 0x10))};
+
+			if (_mm_movemask_epi8(a) == 0)
 			{
-				out.emplace_back(last, head);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + 0), _mm_cvtepu8_epi16(a));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + 8), _mm_cvtepu8_epi16(_mm_srli_si128(a, 8)));
 
-				last = tail; // update anchor
+				ptr += 16; out += 16; continue;
 			}
-		}
-	);
 
-	if (last != lhs_0 && last < lhs_N)
-	{
-		out.emplace_back(last, lhs_N);
-	}
+			const uint32_t hi {__mask__(a, b)};
+			const uint32_t c  {__mask__(_mm_cmplt_epi8(a, _mm_set1_epi8(-64)), _mm_cmplt_epi8(b, _mm_set1_epi8(-64)))};
+			const uint32_t l3 {__mask__(_mm_cmpgt_epi8(a, _mm_set1_epi8(-33)), _mm_cmpgt_epi8(b, _mm_set1_epi8(-33))) & hi};
+			const uint32_t l4 {__mask__(_mm_cmpgt_epi8(a, _mm_set1_epi8(-17)), _mm_cmpgt_epi8(b, _mm_set1_epi8(-17))) & hi & 0xFFFF};
+			const uint32_t l5 {__mask__(_mm_cmpgt_epi8(a, _mm_set1_epi8(-9)), _mm_cmpgt_epi8(b, _mm_set1_epi8(-9))) & hi & 0xFFFF};
 
-	return out;
-}
-
-template <typename Codec,
-          typename Other> constexpr auto detail::__match__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
-	                                                       const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> std::vector<txt<Codec>>
-{
-	typedef typename Codec::T T;
-	typedef typename Other::T U;
+			const uint32_t lead {~c & 0xFFFF};
+			const uint32_t l2 {hi & lead};
 
-	std::vector<txt<Codec>> out;
+			// continuation bytes every lead of the first 16 bytes needs
+			const uint32_t must {(l2 << 1) | ((l3 & 0xFFFF) << 2) | (l4 << 3)};
+			const uint32_t size {16u + ((must >> 16) > 0) + ((must >> 16) > 1) + ((must >> 16) > 3) /* bit_width; up to 3 */};
+			const uint32_t span {(1u << size) - 1};
 
-	__scan__<Codec, Other>(lhs_0, lhs_N,
-	                       rhs_0, rhs_N,
-		// on every distinct match found
-		[&](const T* head, const T* tail)
-		{
-			out.emplace_back(head, tail);
-		}
-	);
+			// malformed; leave it to the scalar path
+			if ((c & span) != must || l5 != 0) break;
 
-	// if (last != lhs_0 && last < lhs_N)
-	// {
-	// 	out.emplace_back(last, lhs_N);
-	// }
+			// 0xF0 0x80...0x8F is an overlong form that decodes below U+10000
+			if (l4 != 0 && (_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, _mm_set1_epi8(-16)), _mm_cmplt_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + 1)), _mm_set1_epi8(-112)))) != 0)) break;
 
-	return out;
-}
+			const uint32_t pair {l4 << 1};
+			const uint32_t keep {lead | pair};
 
-template <typename Codec> constexpr auto detail::__substr__(const typename Codec::T* head, const typename Codec::T* tail, clamp  start, clamp  until) noexcept -> txt<Codec>
-{
-	typedef typename Codec::T T;
+			for (uint32_t i {0}; i < 16; i += 8)
+			{
+				const uint32_t mask {(keep >> i) & 0xFF};
 
-	// e.g. str.substr(N - 1, N - 0);
+				const __m128i code {_mm_shuffle_epi8(__decode16__(ptr + i, pair >> i), _mm_loadu_si128(reinterpret_cast<const __m128i*>(__pack16__.mask[mask])))};
 
-	assert(until < start);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out), code);
 
-	const T* foo {tail};
-	
-	for (size_t i {  0  }; i < until && head < foo; ++i, foo += Codec::back(foo)) {}
+				out += std::popcount(mask);
+			}
 
-	const T* bar {foo};
+			// the low surrogate of a pair led by the last byte
+			if (pair & 0x10000) *out++ = 0xDC00 | ((ptr[17] & 0x0F) << 6) | (ptr[18] & 0x3F);
 
-	for (size_t i {until}; i < start && head < bar; ++i, bar += Codec::back(bar)) {}
+			ptr += size;
+		}
+		head = ptr;
+		dest = out;
+	}
 
-	assert(head <= foo && foo <= tail);
-	assert(head <= bar && bar <= tail);
+	// pshufb masks that left-pack the first 0...3 bytes of each 32-bit lane, as told by 2 bits per lane.
+	static constexpr const auto __pack8__ {[]() consteval
+	{
+		struct { uint8_t mask[256][16]; uint8_t size[256]; } out {};
 
-	return {bar, foo};
-}
+		for (uint16_t keep {0}; keep < 256; ++keep)
+		{
+			uint8_t i {0};
 
-template <typename Codec> constexpr auto detail::__substr__(const typename Codec::T* head, const typename Codec::T* tail, [[maybe_unused]] clamp  start, [[maybe_unused]] range  until) noexcept -> txt<Codec>
-{
-	typedef typename Codec::T T;
+			for (uint8_t lane {0}; lane < 4; ++lane)
+			{
+				for (uint8_t byte {0}; byte < ((keep >> (2 * lane)) & 3); ++byte)
+				{
+					out.mask[keep][i++] = 4 * lane + byte;
+				}
+			}
+			out.size[keep] = i;
 
-	// e.g. str.substr(N - 1, N);
+			for (; i < 16; ++i) out.mask[keep][i] = 0x80;
+		}
+		return out;
+	}()};
 
-	const T* foo {tail};
+	// encodes 4 code units, given in 32-bit lanes along with the ones before them, into 1...3 bytes per lane.
+	TARGET(SSE42) static inline auto __encode8__(__m128i code, __m128i prev) noexcept -> __m128i
+	{
+		const __m128i x3F {_mm_set1_epi32(0x3F)};
+		const __m128i x80 {_mm_set1_epi32(0x80)};
 
-	for (size_t i {  0  }; i < start && head < foo; ++i, foo += Codec::back(foo)) {}
+		const __m128i two {_mm_or_si128(_mm_or_si128(_mm_srli_epi32(code, 6), _mm_set1_epi32(0xC0)),
+		                                _mm_slli_epi32(_mm_or_si128(_mm_and_si128(code, x3F), x80), 8))};
 
-	const T* bar {tail};
+		const __m128i three {_mm_or_si128(_mm_or_si128(_mm_srli_epi32(code, 12), _mm_set1_epi32(0xE0)),
+		                                  _mm_or_si128(_mm_slli_epi32(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(code, 6), x3F), x80), 8),
+		                                               _mm_slli_epi32(_mm_or_si128(_mm_and_si128(code, x3F), x80), 16)))};
 
-	assert(head <= foo && foo <= tail);
-	assert(head <= bar && bar <= tail);
+		// a surrogate pair splits its 4 bytes over its 2 code units
+		const __m128i w {_mm_add_epi32(_mm_and_si128(code, _mm_set1_epi32(0x3FF)), _mm_set1_epi32(0x40))};
 
-	return {foo, bar};
-}
+		const __m128i hi {_mm_or_si128(_mm_or_si128(_mm_srli_epi32(w, 8), _mm_set1_epi32(0xF0)),
+		                               _mm_slli_epi32(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(w, 2), x3F), x80), 8))};
 
-template <typename Codec> constexpr auto detail::__substr__(const typename Codec::T* head, const typename Codec::T* tail, [[maybe_unused]] size_t start, [[maybe_unused]] clamp  until) noexcept -> txt<Codec>
-{
-	typedef typename Codec::T T;
+		const __m128i lo {_mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(_mm_and_si128(prev, _mm_set1_epi32(0x03)), 4),
+		                                                         _mm_and_si128(_mm_srli_epi32(code, 6), _mm_set1_epi32(0x0F))), x80),
+		                               _mm_slli_epi32(_mm_or_si128(_mm_and_si128(code, x3F), x80), 8))};
 
-	// e.g. str.substr(0, N - 1);
+		const __m128i kind {_mm_and_si128(code, _mm_set1_epi32(0xFC00))};
 
-	const T* foo {head};
+		__m128i out {code};
 
-	for (size_t i {  0  }; i < start && foo < tail; ++i, foo += Codec::next(foo)) {}
+		out = _mm_blendv_epi8(out, two, _mm_cmpgt_epi32(code, _mm_set1_epi32(0x07F)));
+		out = _mm_blendv_epi8(out, three, _mm_cmpgt_epi32(code, _mm_set1_epi32(0x7FF)));
+		out = _mm_blendv_epi8(out, hi, _mm_cmpeq_epi32(kind, _mm_set1_epi32(0xD800)));
+		out = _mm_blendv_epi8(out, lo, _mm_cmpeq_epi32(kind, _mm_set1_epi32(0xDC00)));
 
-	const T* bar {tail};
+		return out;
+	}
 
-	for (size_t i {  0  }; i < until && head < bar; ++i, bar += Codec::back(bar)) {}
+	// transcodes well-formed UTF-16, 8 code units per iteration; stops at the first malformed block.
+	TARGET(SSE42) static inline auto __utf16to8__(const char16_t*& head, const char16_t* tail, char8_t*& dest) noexcept -> void
+	{
+		const char16_t* ptr {head};
+		/*&*/ char8_t* out {dest};
 
-	assert(head <= foo && foo <= tail);
-	assert(head <= bar && bar <= tail);
+		// every store stays within the output of the code units left, which are at least as many in bytes
+		for (; 32 <= tail - ptr; )
+		{
+			const __m128i v {_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr))};
 
-	return {foo, bar};
-}
+			if (_mm_testz_si128(v, _mm_set1_epi16(static_cast<int16_t>(0xFF80))))
+			{
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(v, v));
 
-template <typename Codec> constexpr auto detail::__substr__(const typename Codec::T* head, const typename Codec::T* tail, [[maybe_unused]] size_t start, [[maybe_unused]] range  until) noexcept -> txt<Codec>
-{
-	typedef typename Codec::T T;
+				ptr += 8; out += 8; continue;
+			}
 
-	// e.g. str.substr(0, N);
+			// 2 bits per code unit
+			const uint32_t b80  {~static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16(static_cast<int16_t>(0xFF80))), _mm_setzero_si128()))) & 0xFFFF};
+			const uint32_t b800 {~static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16(static_cast<int16_t>(0xF800))), _mm_setzero_si128()))) & 0xFFFF};
 
-	const T* foo {head};
+			const __m128i kind {_mm_and_si128(v, _mm_set1_epi16(static_cast<int16_t>(0xFC00)))};
 
-	for (size_t i {  0  }; i < start && foo < tail; ++i, foo += Codec::next(foo)) {}
+			const uint32_t hi {static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi16(kind, _mm_set1_epi16(static_cast<int16_t>(0xD800)))))};
+			const uint32_t lo {static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi16(kind, _mm_set1_epi16(static_cast<int16_t>(0xDC00)))))};
 
-	const T* bar {tail};
+			// malformed; leave it to the scalar path
+			if (lo != ((hi << 2) & 0xFFFF)) break;
 
-	assert(head <= foo && foo <= tail);
-	assert(head <= bar && bar <= tail);
+			// a trailing high surrogate waits for its pair
+			const uint32_t size {8 - (hi >> 15)};
 
-	return {foo, bar};
-}
+			const uint32_t keep {(0x5555 + (b80 & 0x5555) + (b800 & ~(hi | lo) & 0x5555)) & ((1u << (2 * size)) - 1)};
 
-template <typename Codec> constexpr auto detail::__substr__(const typename Codec::T* head, const typename Codec::T* tail, [[maybe_unused]] size_t start, [[maybe_unused]] size_t until) noexcept -> txt<Codec>
-{
-	typedef typename Codec::T T;
+			const __m128i prev {_mm_slli_si128(v, 2)};
 
-	// e.g. str.substr(6, 9);
+			for (uint32_t i {0}; i < 8; i += 4)
+			{
+				const uint32_t mask {(keep >> (2 * i)) & 0xFF};
 
-	assert(start < until);
+				const __m128i code {i == 0 ? _mm_cvtepu16_epi32(v) : _mm_cvtepu16_epi32(_mm_srli_si128(v, 8))};
+				const __m128i back {i == 0 ? _mm_cvtepu16_epi32(prev) : _mm_cvtepu16_epi32(_mm_srli_si128(prev, 8))};
 
-	const T* foo {head};
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_shuffle_epi8(__encode8__(code, back), _mm_loadu_si128(reinterpret_cast<const __m128i*>(__pack8__.mask[mask]))));
 
-	for (size_t i {  0  }; i < start && foo < tail; ++i, foo += Codec::next(foo)) {}
+				out += __pack8__.size[mask];
+			}
+			ptr += size;
+		}
+		head = ptr;
+		dest = out;
+	}
 
-	const T* bar {foo};
+	// pshufb masks that left-pack the first 1...4 bytes of each 32-bit lane, as told by 2 bits per lane.
+	static constexpr const auto __pack4__ {[]() consteval
+	{
+		struct { uint8_t mask[256][16]; uint8_t size[256]; } out {};
 
-	for (size_t i {start}; i < until && bar < tail; ++i, bar += Codec::next(bar)) {}
+		for (uint16_t keep {0}; keep < 256; ++keep)
+		{
+			uint8_t i {0};
 
-	assert(head <= foo && foo <= tail);
-	assert(head <= bar && bar <= tail);
+			for (uint8_t lane {0}; lane < 4; ++lane)
+			{
+				for (uint8_t byte {0}; byte <= ((keep >> (2 * lane)) & 3); ++byte)
+				{
+					out.mask[keep][i++] = 4 * lane + byte;
+				}
+			}
+			out.size[keep] = i;
+
+			for (; i < 16; ++i) out.mask[keep][i] = 0x80;
+		}
+		return out;
+	}()};
+
+	// pshufb masks that left-pack the 32-bit lanes selected by a 4-bit mask.
+	static constexpr const auto __pack32__ {[]() consteval
+	{
+		struct { uint8_t mask[16][16]; } out {};
+
+		for (uint8_t keep {0}; keep < 16; ++keep)
+		{
+			uint8_t i {0};
+
+			for (uint8_t lane {0}; lane < 4; ++lane)
+			{
+				if (keep & (1 << lane))
+				{
+					out.mask[keep][i++] = 4 * lane + 0;
+					out.mask[keep][i++] = 4 * lane + 1;
+					out.mask[keep][i++] = 4 * lane + 2;
+					out.mask[keep][i++] = 4 * lane + 3;
+				}
+			}
+			for (; i < 16; ++i) out.mask[keep][i] = 0x80;
+		}
+		return out;
+	}()};
+
+	// decodes the sequences starting at data[0...3] into 4 code points, 1 per 32-bit lane.
+	TARGET(SSE42) static inline auto __decode32__(const char8_t* data) noexcept -> __m128i
+	{
+		// each lane holds its lead and the 3 bytes after it
+		const __m128i v {_mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), _mm_setr_epi8(0, 1, 2, 3, 1, 2, 3, 4, 2, 3, 4, 5, 3, 4, 5, 6))};
+
+		const __m128i b0 {_mm_and_si128(v, _mm_set1_epi32(0xFF))};
+		const __m128i b1 {_mm_and_si128(_mm_srli_epi32(v, 8), _mm_set1_epi32(0x3F))};
+		const __m128i b2 {_mm_and_si128(_mm_srli_epi32(v, 16), _mm_set1_epi32(0x3F))};
+		const __m128i b3 {_mm_and_si128(_mm_srli_epi32(v, 24), _mm_set1_epi32(0x3F))};
+
+		//┌─────────────────────────────────────────────────────┐
+		//│ 0xxxxxxx                            -> 1 code point │
+		//│ 110xxxxx 10xxxxxx                   -> 1 code point │
+		//│ 1110xxxx 10xxxxxx 10xxxxxx          -> 1 code point │
+		//│ 11110xxx 10xxxxxx 10xxxxxx 10xxxxxx -> 1 code point │
+		//└─────────────────────────────────────────────────────┘
+
+		const __m128i c2 {_mm_or_si128(_mm_slli_epi32(_mm_and_si128(b0, _mm_set1_epi32(0x1F)), 6), b1)};
+		const __m128i c3 {_mm_or_si128(_mm_or_si128(_mm_slli_epi32(_mm_and_si128(b0, _mm_set1_epi32(0x0F)), 12), _mm_slli_epi32(b1, 6)), b2)};
+		const __m128i c4 {_mm_or_si128(_mm_or_si128(_mm_slli_epi32(_mm_and_si128(b0, _mm_set1_epi32(0x07)), 18), _mm_slli_epi32(b1, 12)),
+		                               _mm_or_si128(_mm_slli_epi32(b2, 6), b3))};
+
+		__m128i code {b0};
+
+		code = _mm_blendv_epi8(code, c2, _mm_cmpgt_epi32(b0, _mm_set1_epi32(0x7F)));
+		code = _mm_blendv_epi8(code, c3, _mm_cmpgt_epi32(b0, _mm_set1_epi32(0xDF)));
+		code = _mm_blendv_epi8(code, c4, _mm_cmpgt_epi32(b0, _mm_set1_epi32(0xEF)));
+
+		return code;
+	}
+
+	// transcodes well-formed UTF-8, 16 bytes per iteration; stops at the first malformed block.
+	TARGET(SSE42) static inline auto __utf8to32__(const char8_t*& head, const char8_t* tail, char32_t*& dest) noexcept -> void
+	{
+		const char8_t* ptr {head};
+		/*&*/ char32_t* out {dest};
+
+		// the lookahead reads up to 32 bytes, and every store stays within the output
+		// of the bytes left, which are at least a quarter of them in code points
+		for (; 64 <= tail - ptr; )
+		{
+			const __m128i a {_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + 0x00))};
+			const __m128i b {_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + 0x10))};
+
+			if (_mm_movemask_epi8(a) == 0)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + 0x0), _mm_cvtepu8_epi32(a));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + 0x4), _mm_cvtepu8_epi32(_mm_srli_si128(a, 0x4)));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + 0x8), _mm_cvtepu8_epi32(_mm_srli_si128(a, 0x8)));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + 0xC), _mm_cvtepu8_epi32(_mm_srli_si128(a, 0xC)));
+
+				ptr += 16; out += 16; continue;
+			}
+
+			const uint32_t hi {__mask__(a, b)};
+			const uint32_t c  {__mask__(_mm_cmplt_epi8(a, _mm_set1_epi8(-64)), _mm_cmplt_epi8(b, _mm_set1_epi8(-64)))};
+			const uint32_t l3 {__mask__(_mm_cmpgt_epi8(a, _mm_set1_epi8(-33)), _mm_cmpgt_epi8(b, _mm_set1_epi8(-33))) & hi};
+			const uint32_t l4 {__mask__(_mm_cmpgt_epi8(a, _mm_set1_epi8(-17)), _mm_cmpgt_epi8(b, _mm_set1_epi8(-17))) & hi & 0xFFFF};
+			const uint32_t l5 {__mask__(_mm_cmpgt_epi8(a, _mm_set1_epi8(-9)), _mm_cmpgt_epi8(b, _mm_set1_epi8(-9))) & hi & 0xFFFF};
+
+			const uint32_t lead {~c & 0xFFFF};
+			const uint32_t l2 {hi & lead};
+
+			// continuation bytes every lead of the first 16 bytes needs
+			const uint32_t must {(l2 << 1) | ((l3 & 0xFFFF) << 2) | (l4 << 3)};
+			const uint32_t size {16u + ((must >> 16) > 0) + ((must >> 16) > 1) + ((must >> 16) > 3) /* bit_width; up to 3 */};
+			const uint32_t span {(1u << size) - 1};
+
+			// malformed; leave it to the scalar path (overlong forms decode just like there)
+			if ((c & span) != must || l5 != 0) break;
+
+			for (uint32_t i {0}; i < 16; i += 4)
+			{
+				const uint32_t mask {(lead >> i) & 0xF};
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_shuffle_epi8(__decode32__(ptr + i), _mm_loadu_si128(reinterpret_cast<const __m128i*>(__pack32__.mask[mask]))));
+
+				out += std::popcount(mask);
+			}
+			ptr += size;
+		}
+		head = ptr;
+		dest = out;
+	}
+
+	// encodes 4 code points, 1 per 32-bit lane, into 1...4 bytes per lane.
+	TARGET(SSE42) static inline auto __encode8__(__m128i code) noexcept -> __m128i
+	{
+		const __m128i x3F {_mm_set1_epi32(0x3F)};
+		const __m128i x80 {_mm_set1_epi32(0x80)};
+
+		// continuation bytes, last to first
+		const __m128i t0 {_mm_or_si128(_mm_and_si128(code, x3F), x80)};
+		const __m128i t1 {_mm_or_si128(_mm_and_si128(_mm_srli_epi32(code, 06), x3F), x80)};
+		const __m128i t2 {_mm_or_si128(_mm_and_si128(_mm_srli_epi32(code, 12), x3F), x80)};
+
+		const __m128i two {_mm_or_si128(_mm_or_si128(_mm_srli_epi32(code, 06), _mm_set1_epi32(0xC0)), _mm_slli_epi32(t0, 8))};
+
+		const __m128i three {_mm_or_si128(_mm_or_si128(_mm_srli_epi32(code, 12), _mm_set1_epi32(0xE0)),
+		                                  _mm_or_si128(_mm_slli_epi32(t1, 8), _mm_slli_epi32(t0, 16)))};
+
+		const __m128i four {_mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_srli_epi32(code, 18), _mm_set1_epi32(0xF0)), _mm_slli_epi32(t2, 8)),
+		                                 _mm_or_si128(_mm_slli_epi32(t1, 16), _mm_slli_epi32(t0, 24)))};
+
+		__m128i out {code};
+
+		out = _mm_blendv_epi8(out, two, _mm_cmpgt_epi32(code, _mm_set1_epi32(0x00007F)));
+		out = _mm_blendv_epi8(out, three, _mm_cmpgt_epi32(code, _mm_set1_epi32(0x0007FF)));
+		out = _mm_blendv_epi8(out, four, _mm_cmpgt_epi32(code, _mm_set1_epi32(0x00FFFF)));
+
+		return out;
+	}
+
+	// whether every lane of both vectors is a code point up to U+10FFFF.
+	TARGET(SSE42) static inline auto __valid__(__m128i a, __m128i b) noexcept -> bool
+	{
+		const __m128i max {_mm_set1_epi32(0x10FFFF)};
+
+		return _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_max_epu32(_mm_max_epu32(a, b), max), max)) == 0xFFFF;
+	}
+
+	// transcodes well-formed UTF-32, 8 code points per iteration; stops at the first malformed block.
+	TARGET(SSE42) static inline auto __utf32to8__(const char32_t*& head, const char32_t* tail, char8_t*& dest) noexcept -> void
+	{
+		const char32_t* ptr {head};
+		/*&*/ char8_t* out {dest};
+
+		// every store stays within the output of the code points left, which are at least as many in bytes
+		for (; 32 <= tail - ptr; )
+		{
+			const __m128i a {_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + 0))};
+			const __m128i b {_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + 4))};
+
+			if (_mm_testz_si128(_mm_or_si128(a, b), _mm_set1_epi32(static_cast<int32_t>(0xFFFFFF80))))
+			{
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_setzero_si128()));
+
+				ptr += 8; out += 8; continue;
+			}
+
+			// malformed; leave it to the scalar path
+			if (!__valid__(a, b)) break;
+
+			for (uint32_t i {0}; i < 8; i += 4)
+			{
+				const __m128i code {i == 0 ? a : b};
+
+				// the number of bytes past the first, 0...3 per lane
+				const __m128i n {_mm_sub_epi32(_mm_setzero_si128(), _mm_add_epi32(_mm_add_epi32(_mm_cmpgt_epi32(code, _mm_set1_epi32(0x00007F)),
+				                                                                                _mm_cmpgt_epi32(code, _mm_set1_epi32(0x0007FF))),
+				                                                                  _mm_cmpgt_epi32(code, _mm_set1_epi32(0x00FFFF))))};
+
+				// gather 1 byte per lane, then move lane i's 2 bits to bit 2i
+				const uint32_t mask {((static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_shuffle_epi8(n, _mm_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)))) * 0x41041) >> 18) & 0xFF};
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_shuffle_epi8(__encode8__(code), _mm_loadu_si128(reinterpret_cast<const __m128i*>(__pack4__.mask[mask]))));
+
+				out += __pack4__.size[mask];
+			}
+			ptr += 8;
+		}
+		head = ptr;
+		dest = out;
+	}
+
+	// transcodes well-formed UTF-32, 8 code points per iteration; stops at the first malformed block.
+	TARGET(SSE42) static inline auto __utf32to16__(const char32_t*& head, const char32_t* tail, char16_t*& dest) noexcept -> void
+	{
+		const char32_t* ptr {head};
+		/*&*/ char16_t* out {dest};
+
+		// every store stays within the output of the code points left, which are at least as many in code units
+		for (; 16 <= tail - ptr; )
+		{
+			const __m128i a {_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + 0))};
+			const __m128i b {_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + 4))};
+
+			if (_mm_testz_si128(_mm_or_si128(a, b), _mm_set1_epi32(static_cast<int32_t>(0xFFFF0000))))
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_packus_epi32(a, b));
+
+				ptr += 8; out += 8; continue;
+			}
+
+			// malformed; leave it to the scalar path
+			if (!__valid__(a, b)) break;
+
+			for (uint32_t i {0}; i < 8; i += 4)
+			{
+				const __m128i code {i == 0 ? a : b};
+				const __m128i wide {_mm_cmpgt_epi32(code, _mm_set1_epi32(0xFFFF))};
+
+				// a pair puts its high surrogate in the low half of the lane
+				const __m128i w {_mm_sub_epi32(code, _mm_set1_epi32(0x10000))};
+
+				const __m128i pair {_mm_or_si128(_mm_or_si128(_mm_srli_epi32(w, 10), _mm_set1_epi32(0xD800)),
+				                                 _mm_slli_epi32(_mm_or_si128(_mm_and_si128(w, _mm_set1_epi32(0x3FF)), _mm_set1_epi32(0xDC00)), 16))};
+
+				// the low half of every lane, and the high half of a pair
+				const uint32_t keep {0x55 | (static_cast<uint32_t>(_mm_movemask_epi8(_mm_packs_epi32(wide, wide))) & 0xAA)};
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_shuffle_epi8(_mm_blendv_epi8(code, pair, wide), _mm_loadu_si128(reinterpret_cast<const __m128i*>(__pack16__.mask[keep]))));
+
+				out += std::popcount(keep);
+			}
+			ptr += 8;
+		}
+		head = ptr;
+		dest = out;
+	}
+
+	// transcodes well-formed UTF-16, 8 code units per iteration; stops at the first malformed block.
+	TARGET(SSE42) static inline auto __utf16to32__(const char16_t*& head, const char16_t* tail, char32_t*& dest) noexcept -> void
+	{
+		const char16_t* ptr {head};
+		/*&*/ char32_t* out {dest};
+
+		// every store stays within the output of the code units left, which are at least half as many in code points
+		for (; 32 <= tail - ptr; )
+		{
+			const __m128i v {_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr))};
+
+			const __m128i kind {_mm_and_si128(v, _mm_set1_epi16(static_cast<int16_t>(0xF800)))};
+
+			if (_mm_movemask_epi8(_mm_cmpeq_epi16(kind, _mm_set1_epi16(static_cast<int16_t>(0xD800)))) == 0)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + 0), _mm_cvtepu16_epi32(v));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + 4), _mm_cvtepu16_epi32(_mm_srli_si128(v, 8)));
+
+				ptr += 8; out += 8; continue;
+			}
+
+			const __m128i hi_v {_mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16(static_cast<int16_t>(0xFC00))), _mm_set1_epi16(static_cast<int16_t>(0xD800)))};
+			const __m128i lo_v {_mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16(static_cast<int16_t>(0xFC00))), _mm_set1_epi16(static_cast<int16_t>(0xDC00)))};
+
+			// 1 bit per code unit
+			const uint32_t hi {static_cast<uint32_t>(_mm_movemask_epi8(_mm_packs_epi16(hi_v, _mm_setzero_si128())))};
+			const uint32_t lo {static_cast<uint32_t>(_mm_movemask_epi8(_mm_packs_epi16(lo_v, _mm_setzero_si128())))};
+
+			// malformed; leave it to the scalar path
+			if (lo != ((hi << 1) & 0xFF)) break;
+
+			// a trailing high surrogate waits for its pair
+			const uint32_t size {8 - (hi >> 7)};
+
+			const uint32_t keep {~lo & ((1u << size) - 1)};
+
+			const __m128i next {_mm_srli_si128(v, 2)};
+
+			for (uint32_t i {0}; i < 8; i += 4)
+			{
+				const uint32_t mask {(keep >> i) & 0xF};
+
+				const __m128i code {_mm_cvtepu16_epi32(i == 0 ? v : _mm_srli_si128(v, 8))};
+				const __m128i pair {_mm_cvtepu16_epi32(i == 0 ? next : _mm_srli_si128(next, 8))};
+
+				// ((hi - 0xD800) << 10) + (lo - 0xDC00) + 0x10000
+				const __m128i full {_mm_sub_epi32(_mm_add_epi32(_mm_slli_epi32(code, 10), pair), _mm_set1_epi32(0x35FDC00))};
+
+				const __m128i lead {_mm_cvtepi16_epi32(i == 0 ? hi_v : _mm_srli_si128(hi_v, 8))};
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_shuffle_epi8(_mm_blendv_epi8(code, full, lead), _mm_loadu_si128(reinterpret_cast<const __m128i*>(__pack32__.mask[mask]))));
+
+				out += std::popcount(mask);
+			}
+			ptr += size;
+		}
+		head = ptr;
+		dest = out;
+	}
+
+	// counts the code points of well-formed UTF-8, 16 bytes per iteration; stops at the first malformed block.
+	TARGET(SSE42) static inline auto __count8__(const char8_t*& head, const char8_t* tail) noexcept -> size_t
+	{
+		const char8_t* ptr {head};
+		/*&*/ size_t out {0};
+
+		// continuation bytes the last block's final lead needs from this one
+		uint32_t carry {0};
+
+		for (; 16 <= tail - ptr; ptr += 16)
+		{
+			const __m128i a {_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr))};
+
+			const uint32_t hi {static_cast<uint32_t>(_mm_movemask_epi8(a))};
+
+			if ((hi | carry) == 0)
+			{
+				out += 16; continue;
+			}
+
+			const uint32_t c  {static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmplt_epi8(a, _mm_set1_epi8(-64))))};
+			const uint32_t l3 {static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(a, _mm_set1_epi8(-33)))) & hi};
+			const uint32_t l4 {static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(a, _mm_set1_epi8(-17)))) & hi};
+
+			const uint32_t lead {~c & 0xFFFF};
+			const uint32_t l2 {hi & lead};
+
+			// continuation bytes every lead needs; those past the 16th byte carry into the next block
+			const uint32_t must {(l2 << 1) | (l3 << 2) | (l4 << 3)};
+
+			// malformed; leave it to the scalar path
+			if (c != ((must & 0xFFFF) | carry)) break;
+
+			carry = must >> 16;
+			out += std::popcount(lead);
+		}
+
+		// hand over a sequence cut by the last block to the scalar path
+		if (carry != 0)
+		{
+			do { --ptr; } while ((*ptr & 0xC0) == 0x80); --out;
+		}
+		head = ptr;
+		return out;
+	}
+
+	// counts the code points of well-formed UTF-16, 8 code units per iteration; stops at the first malformed block.
+	TARGET(SSE42) static inline auto __count16__(const char16_t*& head, const char16_t* tail) noexcept -> size_t
+	{
+		const char16_t* ptr {head};
+		/*&*/ size_t out {0};
+
+		// the low surrogate the last block's final code unit needs from this one
+		uint32_t carry {0};
+
+		for (; 8 <= tail - ptr; ptr += 8)
+		{
+			const __m128i kind {_mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)), _mm_set1_epi16(static_cast<int16_t>(0xFC00)))};
+
+			// 2 bits per code unit
+			const uint32_t hi {static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi16(kind, _mm_set1_epi16(static_cast<int16_t>(0xD800)))))};
+			const uint32_t lo {static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi16(kind, _mm_set1_epi16(static_cast<int16_t>(0xDC00)))))};
+
+			// malformed; leave it to the scalar path
+			if (lo != (((hi << 2) & 0xFFFF) | carry)) break;
+
+			carry = hi >> 14;
+			out += 8 - std::popcount(lo) / 2;
+		}
+
+		// hand over a pair cut by the last block to the scalar path
+		if (carry != 0)
+		{
+			--ptr; --out;
+		}
+		head = ptr;
+		return out;
+	}
+
+	// the byte pair classes of the UTF-8 validator (Keiser & Lemire); a pair is ill-formed if the lookups
+	// by the high and low nibble of its 1st byte, and the high nibble of its 2nd byte, share a bit.
+	static constexpr const auto __utf8ck__ {[]() consteval
+	{
+		constexpr const uint8_t TOO_SHORT {1 << 0}; // 11______ 0_______ | 11______ 11______
+		constexpr const uint8_t TOO_LONG  {1 << 1}; // 0_______ 10______
+		constexpr const uint8_t OVERLONG3 {1 << 2}; // 11100000 100_____
+		constexpr const uint8_t TOO_LARGE {1 << 3}; // 11110100 1001____ | 11110101+ 1001____ | ... 101_____
+		constexpr const uint8_t SURROGATE {1 << 4}; // 11101101 101_____
+		constexpr const uint8_t OVERLONG2 {1 << 5}; // 1100000_ 10______
+		constexpr const uint8_t TOO_LARGE_1000 {1 << 6}; // 11110101+ 1000____
+		constexpr const uint8_t OVERLONG4 {1 << 6}; // 11110000 1000____
+		constexpr const uint8_t TWO_CONTS {1 << 7}; // 10______ 10______
+		// the classes whose 1st byte is told by its high nibble alone
+		constexpr const uint8_t CARRY {TOO_SHORT | TOO_LONG | TWO_CONTS};
+
+		struct { uint8_t hi1[16]; uint8_t lo1[16]; uint8_t hi2[16]; uint8_t end[64]; } out
+		{
+			.hi1
+			{
+				// 0_______ ________
+				TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+				TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+				// 10______ ________
+				TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+				// 1100____ ________
+				TOO_SHORT | OVERLONG2,
+				// 1101____ ________
+				TOO_SHORT,
+				// 1110____ ________
+				TOO_SHORT | OVERLONG3 | SURROGATE,
+				// 1111____ ________
+				TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG4,
+			},
+			.lo1
+			{
+				// ____0000 ________
+				CARRY | OVERLONG3 | OVERLONG2 | OVERLONG4,
+				// ____0001 ________
+				CARRY | OVERLONG2,
+				// ____001_ ________
+				CARRY,
+				CARRY,
+				// ____0100 ________
+				CARRY | TOO_LARGE,
+				// ____0101 ________
+				CARRY | TOO_LARGE | TOO_LARGE_1000,
+				// ____011_ ________
+				CARRY | TOO_LARGE | TOO_LARGE_1000,
+				CARRY | TOO_LARGE | TOO_LARGE_1000,
+				// ____1___ ________
+				CARRY | TOO_LARGE | TOO_LARGE_1000,
+				CARRY | TOO_LARGE | TOO_LARGE_1000,
+				CARRY | TOO_LARGE | TOO_LARGE_1000,
+				CARRY | TOO_LARGE | TOO_LARGE_1000,
+				CARRY | TOO_LARGE | TOO_LARGE_1000,
+				// ____1101 ________
+				CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,
+				CARRY | TOO_LARGE | TOO_LARGE_1000,
+				CARRY | TOO_LARGE | TOO_LARGE_1000,
+			},
+			.hi2
+			{
+				// ________ 0_______
+				TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+				TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+				// ________ 1000____
+				TOO_LONG | OVERLONG2 | TWO_CONTS | OVERLONG3 | TOO_LARGE_1000 | OVERLONG4,
+				// ________ 1001____
+				TOO_LONG | OVERLONG2 | TWO_CONTS | OVERLONG3 | TOO_LARGE,
+				// ________ 101_____
+				TOO_LONG | OVERLONG2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+				TOO_LONG | OVERLONG2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+				// ________ 11______
+				TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+			},
+			.end {},
+		};
+
+		// a block may not open a sequence in its last 3 bytes that needs more than it has;
+		// a tier whose blocks are N bytes wide reads the last N of these
+		for (uint8_t i {0}; i < 64; ++i) out.end[i] = 0xFF;
+
+		out.end[61] = 0xF0 - 1;
+		out.end[62] = 0xE0 - 1;
+		out.end[63] = 0xC0 - 1;
+
+		return out;
+	}()};
+
+	// validates UTF-8, 16 bytes per iteration; stops before the block holding the first ill-formed sequence.
+	TARGET(SSE42) static inline auto __check8__(const char8_t*& head, const char8_t* tail) noexcept -> void
+	{
+		const char8_t* ptr {head};
+
+		const __m128i hi1 {_mm_loadu_si128(reinterpret_cast<const __m128i*>(__utf8ck__.hi1))};
+		const __m128i lo1 {_mm_loadu_si128(reinterpret_cast<const __m128i*>(__utf8ck__.lo1))};
+		const __m128i hi2 {_mm_loadu_si128(reinterpret_cast<const __m128i*>(__utf8ck__.hi2))};
+		const __m128i end {_mm_loadu_si128(reinterpret_cast<const __m128i*>(__utf8ck__.end + 48))};
+
+		const __m128i nib {_mm_set1_epi8(0x0F)};
+
+		// the last block, and whether it left a sequence open
+		__m128i prev {_mm_setzero_si128()};
+		__m128i open {_mm_setzero_si128()};
+
+		for (; 16 <= tail - ptr; ptr += 16)
+		{
+			const __m128i a {_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr))};
+
+			if (_mm_movemask_epi8(a) == 0)
+			{
+				// ill-formed; an ASCII block cannot finish what the last one opened
+				if (!_mm_testz_si128(open, open)) break;
+
+				prev = a; continue;
+			}
+
+			const __m128i prev1 {_mm_alignr_epi8(a, prev, 16 - 1)};
+			const __m128i prev2 {_mm_alignr_epi8(a, prev, 16 - 2)};
+			const __m128i prev3 {_mm_alignr_epi8(a, prev, 16 - 3)};
+
+			const __m128i pair {_mm_and_si128(_mm_and_si128(_mm_shuffle_epi8(hi1, _mm_and_si128(_mm_srli_epi16(prev1, 4), nib)),
+			                                                _mm_shuffle_epi8(lo1, _mm_and_si128(prev1, nib))),
+			                                  _mm_shuffle_epi8(hi2, _mm_and_si128(_mm_srli_epi16(a, 4), nib)))};
+
+			// the 3rd and 4th byte of a sequence must be continuations, which the pair lookup flags as TWO_CONTS
+			const __m128i must {_mm_and_si128(_mm_or_si128(_mm_subs_epu8(prev2, _mm_set1_epi8(0xE0 - 0x80)),
+			                                               _mm_subs_epu8(prev3, _mm_set1_epi8(0xF0 - 0x80))),
+			                                  _mm_set1_epi8(static_cast<char>(0x80)))};
+
+			const __m128i bad {_mm_xor_si128(must, pair)};
+
+			// ill-formed; leave it to the scalar path
+			if (!_mm_testz_si128(bad, bad)) break;
+
+			prev = a;
+			open = _mm_subs_epu8(a, end);
+		}
+
+		// hand over the sequence the stop may have cut to the scalar path; all before it is well-formed
+		if (head < ptr && 0x80 <= ptr[-1])
+		{
+			do { --ptr; } while ((*ptr & 0xC0) == 0x80);
+		}
+		head = ptr;
+	}
+
+	// validates UTF-32, 8 code points per iteration; stops before the block holding the first ill-formed code point.
+	TARGET(SSE42) static inline auto __check32__(const char32_t*& head, const char32_t* tail) noexcept -> void
+	{
+		const char32_t* ptr {head};
+
+		for (; 8 <= tail - ptr; ptr += 8)
+		{
+			const __m128i a {_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + 0))};
+			const __m128i b {_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + 4))};
+
+			// U+D800...U+DFFF, once the low 11 bits are gone
+			const __m128i s {_mm_or_si128(_mm_cmpeq_epi32(_mm_and_si128(a, _mm_set1_epi32(static_cast<int32_t>(0xFFFFF800))), _mm_set1_epi32(0xD800)),
+			                              _mm_cmpeq_epi32(_mm_and_si128(b, _mm_set1_epi32(static_cast<int32_t>(0xFFFFF800))), _mm_set1_epi32(0xD800)))};
+
+			// ill-formed; leave it to the scalar path
+			if (!__valid__(a, b) || !_mm_testz_si128(s, s)) break;
+		}
+		head = ptr;
+	}
+
+	// validates ASCII, 16 bytes per iteration; stops before the block holding the first byte past 0x7F.
+	TARGET(SSE42) static inline auto __check7__(const char*& head, const char* tail) noexcept -> void
+	{
+		const char* ptr {head};
+
+		for (; 16 <= tail - ptr; ptr += 16)
+		{
+			// ill-formed; leave it to the scalar path
+			if (_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr))) != 0) break;
+		}
+		head = ptr;
+	}
+
+	// broadcasts a code unit to every lane.
+	template <typename T> TARGET(SSE42) static inline auto __splat__(T unit) noexcept -> __m128i
+	{
+		if constexpr (sizeof(T) == 1) { return _mm_set1_epi8(static_cast<char>(unit)); }
+		if constexpr (sizeof(T) == 2) { return _mm_set1_epi16(static_cast<int16_t>(unit)); }
+		if constexpr (sizeof(T) == 4) { return _mm_set1_epi32(static_cast<int32_t>(unit)); }
+	}
+
+	// compares code units lane by lane; returns a byte mask, one bit per unit.
+	template <typename T> TARGET(SSE42) static inline auto __cmpeq__(__m128i a, __m128i b, __m128i c, __m128i d) noexcept -> uint32_t
+	{
+		if constexpr (sizeof(T) == 1) { return static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, b), _mm_cmpeq_epi8(c, d)))) & 0xFFFF; }
+		if constexpr (sizeof(T) == 2) { return static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi16(a, b), _mm_cmpeq_epi16(c, d)))) & 0x5555; }
+		if constexpr (sizeof(T) == 4) { return static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi32(a, b), _mm_cmpeq_epi32(c, d)))) & 0x1111; }
+	}
+
+	// finds a needle of 2+ units by its 1st and last unit, 16 bytes of candidates per iteration; returns the match or nullptr.
+	// false candidates spend 'credit' and every block earns some back; once it runs dry, the rest is left to the scalar path.
+	template <typename T> TARGET(SSE42) static inline auto __find__(const T*& head, const T* tail, const T* rhs, size_t len, ptrdiff_t& credit) noexcept -> const T*
+	{
+		constexpr const size_t W {16 / sizeof(T)};
+
+		const __m128i first {__splat__<T>(rhs[0])};
+		const __m128i last {__splat__<T>(rhs[len - 1])};
+
+		const T* ptr {head};
+
+		for (; 0 <= credit && W + len - 1 <= static_cast<size_t>(tail - ptr); ptr += W, credit += (W + 7) / 8)
+		{
+			const __m128i a {_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr))};
+			const __m128i b {_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + len - 1))};
+
+			for (uint32_t mask {__cmpeq__<T>(a, first, b, last)}; mask != 0; mask &= mask - 1, --credit)
+			{
+				const T* hit {ptr + std::countr_zero(mask) / sizeof(T)};
+
+				if (std::equal(rhs + 1, rhs + len - 1, hit + 1)) { head = hit; return hit; }
+			}
+		}
+		head = ptr; return nullptr;
+	}
+
+	// transcodes as far as this tier's kernels reach.
+	template <typename T, typename U> TARGET(SSE42) static inline auto __vcopy__(const U*& head, const U* tail, T*& dest) noexcept -> void
+	{
+		if constexpr (std::is_same_v<U, char8_t> && std::is_same_v<T, char16_t>) { __utf8to16__(head, tail, dest); }
+		if constexpr (std::is_same_v<U, char16_t> && std::is_same_v<T, char8_t>) { __utf16to8__(head, tail, dest); }
+		if constexpr (std::is_same_v<U, char8_t> && std::is_same_v<T, char32_t>) { __utf8to32__(head, tail, dest); }
+		if constexpr (std::is_same_v<U, char32_t> && std::is_same_v<T, char8_t>) { __utf32to8__(head, tail, dest); }
+		if constexpr (std::is_same_v<U, char16_t> && std::is_same_v<T, char32_t>) { __utf16to32__(head, tail, dest); }
+		if constexpr (std::is_same_v<U, char32_t> && std::is_same_v<T, char16_t>) { __utf32to16__(head, tail, dest); }
+	}
+
+	// counts as far as this tier's kernels reach.
+	template <typename T> TARGET(SSE42) static inline auto __difcp__(const T*& head, const T* tail) noexcept -> size_t
+	{
+		if constexpr (sizeof(T) == 1) { return __count8__(head, tail); }
+		if constexpr (sizeof(T) == 2) { return __count16__(head, tail); }
+	}
+
+	// validates as far as this tier's kernels reach; the count of UTF-16 stops at the first unpaired surrogate.
+	template <typename T> TARGET(SSE42) static inline auto __check__(const T*& head, const T* tail) noexcept -> void
+	{
+		if constexpr (std::is_same_v<T, char>) { __check7__(head, tail); }
+		if constexpr (std::is_same_v<T, char8_t>) { __check8__(head, tail); }
+		if constexpr (std::is_same_v<T, char16_t>) { __count16__(head, tail); }
+		if constexpr (std::is_same_v<T, char32_t>) { __check32__(head, tail); }
+	}
+}
+
+#endif//X86_64
+
+#pragma endregion SIMD::SSE42
+#pragma region SIMD::AVX2
+
+#if X86_64
+
+namespace detail::avx2
+{
+	// widens/narrows ASCII code units, 32 per iteration; returns the number of units copied.
+	template <typename T, typename U> TARGET(AVX2) static inline auto __ascii__(const U* head, const U* tail, T* dest) noexcept -> size_t
+	{
+		const U* ptr {head};
+
+		for (; 32 <= tail - ptr; ptr += 32, dest += 32)
+		{
+			__m256i bytes;
+
+			if constexpr (sizeof(U) == 1)
+			{
+				bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + 0));
+
+				if (_mm256_movemask_epi8(bytes) != 0) break;
+			}
+			if constexpr (sizeof(U) == 2)
+			{
+				const __m256i a {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + 0x00))};
+				const __m256i b {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + 0x10))};
+
+				if (!_mm256_testz_si256(_mm256_or_si256(a, b), _mm256_set1_epi16(static_cast<int16_t>(0xFF80)))) break;
+
+				// packs are lane-wise; restore the order of 64-bit quarters
+				bytes = _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0b11'01'10'00);
+			}
+			if constexpr (sizeof(U) == 4)
+			{
+				const __m256i a {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + 0x00))};
+				const __m256i b {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + 0x08))};
+				const __m256i c {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + 0x10))};
+				const __m256i d {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + 0x18))};
+
+				if (!_mm256_testz_si256(_mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d)), _mm256_set1_epi32(static_cast<int32_t>(0xFFFFFF80)))) break;
+
+				// packs are lane-wise; restore the order of 32-bit quarters
+				bytes = _mm256_permutevar8x32_epi32(_mm256_packus_epi16(_mm256_packs_epi32(a, b), _mm256_packs_epi32(c, d)), _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+			}
+
+			if constexpr (sizeof(T) == 1)
+			{
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + 0), bytes);
+			}
+			if constexpr (sizeof(T) == 2)
+			{
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + 0x00), _mm256_cvtepu8_epi16(_mm256_castsi256_si128(bytes)));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + 0x10), _mm256_cvtepu8_epi16(_mm256_extracti128_si256(bytes, 1)));
+			}
+			if constexpr (sizeof(T) == 4)
+			{
+				const __m128i lo {_mm256_castsi256_si128(bytes)};
+				const __m128i hi {_mm256_extracti128_si256(bytes, 1)};
+
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + 0x00), _mm256_cvtepu8_epi32(lo));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + 0x08), _mm256_cvtepu8_epi32(_mm_srli_si128(lo, 8)));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + 0x10), _mm256_cvtepu8_epi32(hi));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + 0x18), _mm256_cvtepu8_epi32(_mm_srli_si128(hi, 8)));
+			}
+		}
+		return ptr - head;
+	}
+
+	// decodes the sequences starting at data[0...15] into 16 code units; see sse42::__decode16__.
+	TARGET(AVX2) static inline auto __decode16__(const char8_t* data, uint32_t pair) noexcept -> __m256i
+	{
+		const __m256i b0 {_mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0)))};
+		const __m256i b1 {_mm256_and_si256(_mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 1))), _mm256_set1_epi16(0x3F))};
+		const __m256i b2 {_mm256_and_si256(_mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 2))), _mm256_set1_epi16(0x3F))};
+
+		// the 16-bit shift drops what is left of the lead's prefix
+		const __m256i c2 {_mm256_or_si256(_mm256_slli_epi16(_mm256_and_si256(b0, _mm256_set1_epi16(0x1F)), 6), b1)};
+		const __m256i c3 {_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi16(b0, 12), _mm256_slli_epi16(b1, 6)), b2)};
+
+		const __m256i hi {_mm256_or_si256(_mm256_sub_epi16(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi16(_mm256_and_si256(b0, _mm256_set1_epi16(0x07)), 8),
+		                                                                                    _mm256_slli_epi16(b1, 2)),
+		                                                                    _mm256_srli_epi16(b2, 4)),
+		                                                   _mm256_set1_epi16(0x40)),
+		                                  _mm256_set1_epi16(static_cast<int16_t>(0xD800)))};
+
+		const __m256i lo {_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi16(_mm256_and_si256(b1, _mm256_set1_epi16(0x0F)), 6), b2),
+		                                  _mm256_set1_epi16(static_cast<int16_t>(0xDC00)))};
+
+		const __m256i bit {_mm256_setr_epi16(0x0001, 0x0002, 0x0004, 0x0008, 0x0010, 0x0020, 0x0040, 0x0080,
+		                                     0x0100, 0x0200, 0x0400, 0x0800, 0x1000, 0x2000, 0x4000, static_cast<int16_t>(0x8000))};
+
+		__m256i code {b0};
+
+		code = _mm256_blendv_epi8(code, c2, _mm256_cmpgt_epi16(b0, _mm256_set1_epi16(0x7F)));
+		code = _mm256_blendv_epi8(code, c3, _mm256_cmpgt_epi16(b0, _mm256_set1_epi16(0xDF)));
+		code = _mm256_blendv_epi8(code, hi, _mm256_cmpgt_epi16(b0, _mm256_set1_epi16(0xEF)));
+		code = _mm256_blendv_epi8(code, lo, _mm256_cmpeq_epi16(_mm256_and_si256(_mm256_set1_epi16(static_cast<int16_t>(pair)), bit), bit));
+
+		return code;
+	}
+
+	// left-packs the 16-bit lanes selected by keep; returns the number of code units written.
+	TARGET(AVX2) static inline auto __store16__(char16_t* dest, __m256i code, uint32_t keep) noexcept -> size_t
+	{
+		// pshufb is lane-wise; pack each 128-bit half on its own
+		const uint32_t lo_keep {keep & 0xFF};
+		const uint32_t hi_keep {keep >> 8 & 0xFF};
+
+		const size_t lo_n {static_cast<size_t>(std::popcount(lo_keep))};
+		const size_t hi_n {static_cast<size_t>(std::popcount(hi_keep))};
+
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + 0x00), _mm_shuffle_epi8(_mm256_castsi256_si128(code), _mm_loadu_si128(reinterpret_cast<const __m128i*>(sse42::__pack16__.mask[lo_keep]))));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + lo_n), _mm_shuffle_epi8(_mm256_extracti128_si256(code, 1), _mm_loadu_si128(reinterpret_cast<const __m128i*>(sse42::__pack16__.mask[hi_keep]))));
+
+		return lo_n + hi_n;
+	}
+
+	// gathers the sign bits of 2 vectors of bytes into one mask.
+	TARGET(AVX2) static inline auto __mask__(__m256i a, __m256i b) noexcept -> uint64_t
+	{
+		return static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(a)))
+		       |
+		       static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(b))) << 32;
+	}
+
+	// transcodes well-formed UTF-8, 32 bytes per iteration; stops at the first malformed block.
+	TARGET(AVX2) static inline auto __utf8to16__(const char8_t*& head, const char8_t* tail, char16_t*& dest) noexcept -> void
+	{
+		const char8_t* ptr {head};
+		/*&*/ char16_t* out {dest};
+
+		// the lookahead reads up to 64 bytes, and every store stays within the output
+		// of the bytes left, which are at least a quarter of them in code units
+		for (; 128 <= tail - ptr; )
+		{
+			const __m256i a {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + 0x00))};
+			const __m256i b {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + 0x20))};
+
+			if (_mm256_movemask_epi8(a) == 0)
+			{
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0x00), _mm256_cvtepu8_epi16(_mm256_castsi256_si128(a)));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0x10), _mm256_cvtepu8_epi16(_mm256_extracti128_si256(a, 1)));
+
+				ptr += 32; out += 32; continue;
+			}
+
+			const uint64_t hi {__mask__(a, b)};
+			const uint64_t c  {__mask__(_mm256_cmpgt_epi8(_mm256_set1_epi8(-64), a), _mm256_cmpgt_epi8(_mm256_set1_epi8(-64), b))};
+			const uint64_t l3 {__mask__(_mm256_cmpgt_epi8(a, _mm256_set1_epi8(-33)), _mm256_cmpgt_epi8(b, _mm256_set1_epi8(-33))) & hi};
+			const uint64_t l4 {__mask__(_mm256_cmpgt_epi8(a, _mm256_set1_epi8(-17)), _mm256_cmpgt_epi8(b, _mm256_set1_epi8(-17))) & hi & 0xFFFFFFFF};
+			const uint64_t l5 {__mask__(_mm256_cmpgt_epi8(a, _mm256_set1_epi8(-9)), _mm256_cmpgt_epi8(b, _mm256_set1_epi8(-9))) & hi & 0xFFFFFFFF};
+
+			const uint64_t lead {~c & 0xFFFFFFFF};
+			const uint64_t l2 {hi & lead};
+
+			// continuation bytes every lead of the first 32 bytes needs
+			const uint64_t must {(l2 << 1) | ((l3 & 0xFFFFFFFF) << 2) | (l4 << 3)};
+			const uint64_t size {32ull + ((must >> 32) > 0) + ((must >> 32) > 1) + ((must >> 32) > 3) /* bit_width; up to 3 */};
+			const uint64_t span {(1ull << size) - 1};
+
+			// malformed; leave it to the scalar path
+			if ((c & span) != must || l5 != 0) break;
+
+			// 0xF0 0x80...0x8F is an overlong form that decodes below U+10000
+			if (l4 != 0 && (_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(a, _mm256_set1_epi8(-16)), _mm256_cmpgt_epi8(_mm256_set1_epi8(-112), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + 1))))) != 0)) break;
+
+			const uint64_t pair {l4 << 1};
+			const uint64_t keep {lead | pair};
+
+			for (uint32_t i {0}; i < 32; i += 16)
+			{
+				out += __store16__(out, __decode16__(ptr + i, static_cast<uint32_t>(pair >> i)), static_cast<uint32_t>(keep >> i) & 0xFFFF);
+			}
+
+			// the low surrogate of a pair led by the last byte
+			if (pair & 0x100000000) *out++ = 0xDC00 | ((ptr[33] & 0x0F) << 6) | (ptr[34] & 0x3F);
+
+			ptr += size;
+		}
+		head = ptr;
+		dest = out;
+	}
+
+	// encodes 8 code units, given in 32-bit lanes along with the ones before them; see sse42::__encode8__.
+	TARGET(AVX2) static inline auto __encode8__(__m256i code, __m256i prev) noexcept -> __m256i
+	{
+		const __m256i x3F {_mm256_set1_epi32(0x3F)};
+		const __m256i x80 {_mm256_set1_epi32(0x80)};
+
+		const __m256i two {_mm256_or_si256(_mm256_or_si256(_mm256_srli_epi32(code, 6), _mm256_set1_epi32(0xC0)),
+		                                   _mm256_slli_epi32(_mm256_or_si256(_mm256_and_si256(code, x3F), x80), 8))};
+
+		const __m256i three {_mm256_or_si256(_mm256_or_si256(_mm256_srli_epi32(code, 12), _mm256_set1_epi32(0xE0)),
+		                                     _mm256_or_si256(_mm256_slli_epi32(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(code, 6), x3F), x80), 8),
+		                                                     _mm256_slli_epi32(_mm256_or_si256(_mm256_and_si256(code, x3F), x80), 16)))};
+
+		// a surrogate pair splits its 4 bytes over its 2 code units
+		const __m256i w {_mm256_add_epi32(_mm256_and_si256(code, _mm256_set1_epi32(0x3FF)), _mm256_set1_epi32(0x40))};
+
+		const __m256i hi {_mm256_or_si256(_mm256_or_si256(_mm256_srli_epi32(w, 8), _mm256_set1_epi32(0xF0)),
+		                                  _mm256_slli_epi32(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(w, 2), x3F), x80), 8))};
+
+		const __m256i lo {_mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(_mm256_and_si256(prev, _mm256_set1_epi32(0x03)), 4),
+		                                                                  _mm256_and_si256(_mm256_srli_epi32(code, 6), _mm256_set1_epi32(0x0F))), x80),
+		                                  _mm256_slli_epi32(_mm256_or_si256(_mm256_and_si256(code, x3F), x80), 8))};
+
+		const __m256i kind {_mm256_and_si256(code, _mm256_set1_epi32(0xFC00))};
+
+		__m256i out {code};
+
+		out = _mm256_blendv_epi8(out, two, _mm256_cmpgt_epi32(code, _mm256_set1_epi32(0x07F)));
+		out = _mm256_blendv_epi8(out, three, _mm256_cmpgt_epi32(code, _mm256_set1_epi32(0x7FF)));
+		out = _mm256_blendv_epi8(out, hi, _mm256_cmpeq_epi32(kind, _mm256_set1_epi32(0xD800)));
+		out = _mm256_blendv_epi8(out, lo, _mm256_cmpeq_epi32(kind, _mm256_set1_epi32(0xDC00)));
+
+		return out;
+	}
+
+	// transcodes well-formed UTF-16, 16 code units per iteration; stops at the first malformed block.
+	TARGET(AVX2) static inline auto __utf16to8__(const char16_t*& head, const char16_t* tail, char8_t*& dest) noexcept -> void
+	{
+		const char16_t* ptr {head};
+		/*&*/ char8_t* out {dest};
+
+		// every store stays within the output of the code units left, which are at least as many in bytes
+		for (; 64 <= tail - ptr; )
+		{
+			const __m256i v {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr))};
+
+			if (_mm256_testz_si256(v, _mm256_set1_epi16(static_cast<int16_t>(0xFF80))))
+			{
+				// packs are lane-wise; restore the order of 64-bit quarters
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm256_castsi256_si128(_mm256_permute4x64_epi64(_mm256_packus_epi16(v, v), 0b10'00)));
+
+				ptr += 16; out += 16; continue;
+			}
+
+			// 2 bits per code unit
+			const uint32_t b80  {~static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_and_si256(v, _mm256_set1_epi16(static_cast<int16_t>(0xFF80))), _mm256_setzero_si256())))};
+			const uint32_t b800 {~static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_and_si256(v, _mm256_set1_epi16(static_cast<int16_t>(0xF800))), _mm256_setzero_si256())))};
+
+			const __m256i kind {_mm256_and_si256(v, _mm256_set1_epi16(static_cast<int16_t>(0xFC00)))};
+
+			const uint32_t hi {static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(kind, _mm256_set1_epi16(static_cast<int16_t>(0xD800)))))};
+			const uint32_t lo {static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(kind, _mm256_set1_epi16(static_cast<int16_t>(0xDC00)))))};
+
+			// malformed; leave it to the scalar path
+			if (lo != (hi << 2)) break;
+
+			// a trailing high surrogate waits for its pair
+			const uint32_t size {16 - (hi >> 31)};
+
+			const uint32_t keep {(0x55555555 + (b80 & 0x55555555) + (b800 & ~(hi | lo) & 0x55555555)) & (size == 16 ? 0xFFFFFFFF : 0x3FFFFFFF)};
+
+			// shift in the code unit before each lane, across the 128-bit halves
+			const __m256i prev {_mm256_alignr_epi8(v, _mm256_permute2x128_si256(v, v, 0x08), 14)};
+
+			for (uint32_t i {0}; i < 16; i += 8)
+			{
+				const uint32_t lo_mask {(keep >> (2 * i + 0)) & 0xFF};
+				const uint32_t hi_mask {(keep >> (2 * i + 8)) & 0xFF};
+
+				const __m256i code {_mm256_cvtepu16_epi32(i == 0 ? _mm256_castsi256_si128(v) : _mm256_extracti128_si256(v, 1))};
+				const __m256i back {_mm256_cvtepu16_epi32(i == 0 ? _mm256_castsi256_si128(prev) : _mm256_extracti128_si256(prev, 1))};
+
+				const __m256i bytes {__encode8__(code, back)};
+
+				// pshufb is lane-wise; pack each 128-bit half on its own
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_shuffle_epi8(_mm256_castsi256_si128(bytes), _mm_loadu_si128(reinterpret_cast<const __m128i*>(sse42::__pack8__.mask[lo_mask]))));
+				out += sse42::__pack8__.size[lo_mask];
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_shuffle_epi8(_mm256_extracti128_si256(bytes, 1), _mm_loadu_si128(reinterpret_cast<const __m128i*>(sse42::__pack8__.mask[hi_mask]))));
+				out += sse42::__pack8__.size[hi_mask];
+			}
+			ptr += size;
+		}
+		head = ptr;
+		dest = out;
+	}
+
+	// decodes the sequences starting at data[0...7] into 8 code points; see sse42::__decode32__.
+	TARGET(AVX2) static inline auto __decode32__(const char8_t* data) noexcept -> __m256i
+	{
+		// each lane holds its lead and the 3 bytes after it
+		const __m256i v {_mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data))),
+		                                     _mm256_setr_epi8(0, 1, 2, 3, 1, 2, 3, 4, 2, 3, 4, 5, 3, 4, 5, 6, 4, 5, 6, 7, 5, 6, 7, 8, 6, 7, 8, 9, 7, 8, 9, 10))};
+
+		const __m256i b0 {_mm256_and_si256(v, _mm256_set1_epi32(0xFF))};
+		const __m256i b1 {_mm256_and_si256(_mm256_srli_epi32(v, 8), _mm256_set1_epi32(0x3F))};
+		const __m256i b2 {_mm256_and_si256(_mm256_srli_epi32(v, 16), _mm256_set1_epi32(0x3F))};
+		const __m256i b3 {_mm256_and_si256(_mm256_srli_epi32(v, 24), _mm256_set1_epi32(0x3F))};
+
+		const __m256i c2 {_mm256_or_si256(_mm256_slli_epi32(_mm256_and_si256(b0, _mm256_set1_epi32(0x1F)), 6), b1)};
+		const __m256i c3 {_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(_mm256_and_si256(b0, _mm256_set1_epi32(0x0F)), 12), _mm256_slli_epi32(b1, 6)), b2)};
+		const __m256i c4 {_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(_mm256_and_si256(b0, _mm256_set1_epi32(0x07)), 18), _mm256_slli_epi32(b1, 12)),
+		                                  _mm256_or_si256(_mm256_slli_epi32(b2, 6), b3))};
+
+		__m256i code {b0};
+
+		code = _mm256_blendv_epi8(code, c2, _mm256_cmpgt_epi32(b0, _mm256_set1_epi32(0x7F)));
+		code = _mm256_blendv_epi8(code, c3, _mm256_cmpgt_epi32(b0, _mm256_set1_epi32(0xDF)));
+		code = _mm256_blendv_epi8(code, c4, _mm256_cmpgt_epi32(b0, _mm256_set1_epi32(0xEF)));
+
+		return code;
+	}
+
+	// left-packs the 32-bit lanes selected by keep; returns the number of code points written.
+	TARGET(AVX2) static inline auto __store32__(char32_t* dest, __m256i code, uint32_t keep) noexcept -> size_t
+	{
+		// widen each bit of keep to a byte, then gather the indices of the lanes it selects
+		const uint64_t index {_pext_u64(0x0706050403020100, _pdep_u64(keep, 0x0101010101010101) * 0xFF)};
+
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(dest), _mm256_permutevar8x32_epi32(code, _mm256_cvtepu8_epi32(_mm_cvtsi64_si128(static_cast<int64_t>(index)))));
+
+		return std::popcount(keep);
+	}
+
+	// transcodes well-formed UTF-8, 32 bytes per iteration; stops at the first malformed block.
+	TARGET(AVX2) static inline auto __utf8to32__(const char8_t*& head, const char8_t* tail, char32_t*& dest) noexcept -> void
+	{
+		const char8_t* ptr {head};
+		/*&*/ char32_t* out {dest};
+
+		// the lookahead reads up to 64 bytes, and every store stays within the output
+		// of the bytes left, which are at least a quarter of them in code points
+		for (; 128 <= tail - ptr; )
+		{
+			const __m256i a {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + 0x00))};
+			const __m256i b {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + 0x20))};
+
+			if (_mm256_movemask_epi8(a) == 0)
+			{
+				const __m128i lo {_mm256_castsi256_si128(a)};
+				const __m128i hi {_mm256_extracti128_si256(a, 1)};
+
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0x00), _mm256_cvtepu8_epi32(lo));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0x08), _mm256_cvtepu8_epi32(_mm_srli_si128(lo, 8)));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0x10), _mm256_cvtepu8_epi32(hi));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0x18), _mm256_cvtepu8_epi32(_mm_srli_si128(hi, 8)));
+
+				ptr += 32; out += 32; continue;
+			}
+
+			const uint64_t hi {__mask__(a, b)};
+			const uint64_t c  {__mask__(_mm256_cmpgt_epi8(_mm256_set1_epi8(-64), a), _mm256_cmpgt_epi8(_mm256_set1_epi8(-64), b))};
+			const uint64_t l3 {__mask__(_mm256_cmpgt_epi8(a, _mm256_set1_epi8(-33)), _mm256_cmpgt_epi8(b, _mm256_set1_epi8(-33))) & hi};
+			const uint64_t l4 {__mask__(_mm256_cmpgt_epi8(a, _mm256_set1_epi8(-17)), _mm256_cmpgt_epi8(b, _mm256_set1_epi8(-17))) & hi & 0xFFFFFFFF};
+			const uint64_t l5 {__mask__(_mm256_cmpgt_epi8(a, _mm256_set1_epi8(-9)), _mm256_cmpgt_epi8(b, _mm256_set1_epi8(-9))) & hi & 0xFFFFFFFF};
+
+			const uint64_t lead {~c & 0xFFFFFFFF};
+			const uint64_t l2 {hi & lead};
+
+			// continuation bytes every lead of the first 32 bytes needs
+			const uint64_t must {(l2 << 1) | ((l3 & 0xFFFFFFFF) << 2) | (l4 << 3)};
+			const uint64_t size {32ull + ((must >> 32) > 0) + ((must >> 32) > 1) + ((must >> 32) > 3) /* bit_width; up to 3 */};
+			const uint64_t span {(1ull << size) - 1};
+
+			// malformed; leave it to the scalar path (overlong forms decode just like there)
+			if ((c & span) != must || l5 != 0) break;
+
+			for (uint32_t i {0}; i < 32; i += 8)
+			{
+				out += __store32__(out, __decode32__(ptr + i), static_cast<uint32_t>(lead >> i) & 0xFF);
+			}
+			ptr += size;
+		}
+		head = ptr;
+		dest = out;
+	}
+
+	// encodes 8 code points into 1...4 bytes per lane; see sse42::__encode8__.
+	TARGET(AVX2) static inline auto __encode8__(__m256i code) noexcept -> __m256i
+	{
+		const __m256i x3F {_mm256_set1_epi32(0x3F)};
+		const __m256i x80 {_mm256_set1_epi32(0x80)};
+
+		// continuation bytes, last to first
+		const __m256i t0 {_mm256_or_si256(_mm256_and_si256(code, x3F), x80)};
+		const __m256i t1 {_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(code, 06), x3F), x80)};
+		const __m256i t2 {_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(code, 12), x3F), x80)};
+
+		const __m256i two {_mm256_or_si256(_mm256_or_si256(_mm256_srli_epi32(code, 06), _mm256_set1_epi32(0xC0)), _mm256_slli_epi32(t0, 8))};
+
+		const __m256i three {_mm256_or_si256(_mm256_or_si256(_mm256_srli_epi32(code, 12), _mm256_set1_epi32(0xE0)),
+		                                     _mm256_or_si256(_mm256_slli_epi32(t1, 8), _mm256_slli_epi32(t0, 16)))};
+
+		const __m256i four {_mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_srli_epi32(code, 18), _mm256_set1_epi32(0xF0)), _mm256_slli_epi32(t2, 8)),
+		                                    _mm256_or_si256(_mm256_slli_epi32(t1, 16), _mm256_slli_epi32(t0, 24)))};
+
+		__m256i out {code};
+
+		out = _mm256_blendv_epi8(out, two, _mm256_cmpgt_epi32(code, _mm256_set1_epi32(0x00007F)));
+		out = _mm256_blendv_epi8(out, three, _mm256_cmpgt_epi32(code, _mm256_set1_epi32(0x0007FF)));
+		out = _mm256_blendv_epi8(out, four, _mm256_cmpgt_epi32(code, _mm256_set1_epi32(0x00FFFF)));
+
+		return out;
+	}
+
+	// whether every lane of both vectors is a code point up to U+10FFFF.
+	TARGET(AVX2) static inline auto __valid__(__m256i a, __m256i b) noexcept -> bool
+	{
+		const __m256i max {_mm256_set1_epi32(0x10FFFF)};
+
+		return _mm256_movemask_epi8(_mm256_cmpeq_epi32(_mm256_max_epu32(_mm256_max_epu32(a, b), max), max)) == -1;
+	}
+
+	// gathers a 32-bit lane compare into 1 bit per lane.
+	TARGET(AVX2) static inline auto __lane__(__m256i mask) noexcept -> uint32_t
+	{
+		return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(mask)));
+	}
+
+	// transcodes well-formed UTF-32, 16 code points per iteration; stops at the first malformed block.
+	TARGET(AVX2) static inline auto __utf32to8__(const char32_t*& head, const char32_t* tail, char8_t*& dest) noexcept -> void
+	{
+		const char32_t* ptr {head};
+		/*&*/ char8_t* out {dest};
+
+		// every store stays within the output of the code points left, which are at least as many in bytes
+		for (; 64 <= tail - ptr; )
+		{
+			const __m256i a {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + 0))};
+			const __m256i b {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + 8))};
+
+			if (_mm256_testz_si256(_mm256_or_si256(a, b), _mm256_set1_epi32(static_cast<int32_t>(0xFFFFFF80))))
+			{
+				const __m128i x {_mm_packs_epi32(_mm256_castsi256_si128(a), _mm256_extracti128_si256(a, 1))};
+				const __m128i y {_mm_packs_epi32(_mm256_castsi256_si128(b), _mm256_extracti128_si256(b, 1))};
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(x, y));
+
+				ptr += 16; out += 16; continue;
+			}
+
+			// malformed; leave it to the scalar path
+			if (!__valid__(a, b)) break;
+
+			for (uint32_t i {0}; i < 16; i += 8)
+			{
+				const __m256i code {i == 0 ? a : b};
+
+				// the number of bytes past the first, 2 bits per lane
+				const uint32_t keep {_pdep_u32(__lane__(_mm256_cmpgt_epi32(code, _mm256_set1_epi32(0x00007F))), 0x5555)
+				                     +
+				                     _pdep_u32(__lane__(_mm256_cmpgt_epi32(code, _mm256_set1_epi32(0x0007FF))), 0x5555)
+				                     +
+				                     _pdep_u32(__lane__(_mm256_cmpgt_epi32(code, _mm256_set1_epi32(0x00FFFF))), 0x5555)};
+
+				const uint32_t lo_mask {(keep >> 0) & 0xFF};
+				const uint32_t hi_mask {(keep >> 8) & 0xFF};
+
+				const __m256i bytes {__encode8__(code)};
+
+				// pshufb is lane-wise; pack each 128-bit half on its own
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_shuffle_epi8(_mm256_castsi256_si128(bytes), _mm_loadu_si128(reinterpret_cast<const __m128i*>(sse42::__pack4__.mask[lo_mask]))));
+				out += sse42::__pack4__.size[lo_mask];
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_shuffle_epi8(_mm256_extracti128_si256(bytes, 1), _mm_loadu_si128(reinterpret_cast<const __m128i*>(sse42::__pack4__.mask[hi_mask]))));
+				out += sse42::__pack4__.size[hi_mask];
+			}
+			ptr += 16;
+		}
+		head = ptr;
+		dest = out;
+	}
+
+	// transcodes well-formed UTF-32, 16 code points per iteration; stops at the first malformed block.
+	TARGET(AVX2) static inline auto __utf32to16__(const char32_t*& head, const char32_t* tail, char16_t*& dest) noexcept -> void
+	{
+		const char32_t* ptr {head};
+		/*&*/ char16_t* out {dest};
+
+		// every store stays within the output of the code points left, which are at least as many in code units
+		for (; 32 <= tail - ptr; )
+		{
+			const __m256i a {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + 0))};
+			const __m256i b {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + 8))};
+
+			if (_mm256_testz_si256(_mm256_or_si256(a, b), _mm256_set1_epi32(static_cast<int32_t>(0xFFFF0000))))
+			{
+				// packs are lane-wise; restore the order of 64-bit quarters
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out), _mm256_permute4x64_epi64(_mm256_packus_epi32(a, b), 0b11'01'10'00));
+
+				ptr += 16; out += 16; continue;
+			}
+
+			// malformed; leave it to the scalar path
+			if (!__valid__(a, b)) break;
+
+			for (uint32_t i {0}; i < 16; i += 8)
+			{
+				const __m256i code {i == 0 ? a : b};
+				const __m256i wide {_mm256_cmpgt_epi32(code, _mm256_set1_epi32(0xFFFF))};
+
+				// a pair puts its high surrogate in the low half of the lane
+				const __m256i w {_mm256_sub_epi32(code, _mm256_set1_epi32(0x10000))};
+
+				const __m256i pair {_mm256_or_si256(_mm256_or_si256(_mm256_srli_epi32(w, 10), _mm256_set1_epi32(0xD800)),
+				                                    _mm256_slli_epi32(_mm256_or_si256(_mm256_and_si256(w, _mm256_set1_epi32(0x3FF)), _mm256_set1_epi32(0xDC00)), 16))};
+
+				// the low half of every lane, and the high half of a pair
+				const uint32_t keep {0x5555 | _pdep_u32(__lane__(wide), 0xAAAA)};
+
+				out += __store16__(out, _mm256_blendv_epi8(code, pair, wide), keep);
+			}
+			ptr += 16;
+		}
+		head = ptr;
+		dest = out;
+	}
+
+	// transcodes well-formed UTF-16, 16 code units per iteration; stops at the first malformed block.
+	TARGET(AVX2) static inline auto __utf16to32__(const char16_t*& head, const char16_t* tail, char32_t*& dest) noexcept -> void
+	{
+		const char16_t* ptr {head};
+		/*&*/ char32_t* out {dest};
+
+		// every store stays within the output of the code units left, which are at least half as many in code points
+		for (; 64 <= tail - ptr; )
+		{
+			const __m256i v {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr))};
+
+			const __m256i kind {_mm256_and_si256(v, _mm256_set1_epi16(static_cast<int16_t>(0xF800)))};
+
+			if (_mm256_movemask_epi8(_mm256_cmpeq_epi16(kind, _mm256_set1_epi16(static_cast<int16_t>(0xD800)))) == 0)
+			{
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0), _mm256_cvtepu16_epi32(_mm256_castsi256_si128(v)));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8), _mm256_cvtepu16_epi32(_mm256_extracti128_si256(v, 1)));
+
+				ptr += 16; out += 16; continue;
+			}
+
+			const __m256i hi_v {_mm256_cmpeq_epi16(_mm256_and_si256(v, _mm256_set1_epi16(static_cast<int16_t>(0xFC00))), _mm256_set1_epi16(static_cast<int16_t>(0xD800)))};
+			const __m256i lo_v {_mm256_cmpeq_epi16(_mm256_and_si256(v, _mm256_set1_epi16(static_cast<int16_t>(0xFC00))), _mm256_set1_epi16(static_cast<int16_t>(0xDC00)))};
+
+			// 1 bit per code unit
+			const uint32_t hi {_pext_u32(static_cast<uint32_t>(_mm256_movemask_epi8(hi_v)), 0x55555555)};
+			const uint32_t lo {_pext_u32(static_cast<uint32_t>(_mm256_movemask_epi8(lo_v)), 0x55555555)};
+
+			// malformed; leave it to the scalar path
+			if (lo != ((hi << 1) & 0xFFFF)) break;
+
+			// a trailing high surrogate waits for its pair
+			const uint32_t size {16 - (hi >> 15)};
+
+			const uint32_t keep {~lo & ((1u << size) - 1)};
+
+			// shift in the code unit after each lane, across the 128-bit halves
+			const __m256i next {_mm256_alignr_epi8(_mm256_permute2x128_si256(v, v, 0x81), v, 2)};
+
+			for (uint32_t i {0}; i < 16; i += 8)
+			{
+				const __m256i code {_mm256_cvtepu16_epi32(i == 0 ? _mm256_castsi256_si128(v) : _mm256_extracti128_si256(v, 1))};
+				const __m256i pair {_mm256_cvtepu16_epi32(i == 0 ? _mm256_castsi256_si128(next) : _mm256_extracti128_si256(next, 1))};
+				const __m256i lead {_mm256_cvtepi16_epi32(i == 0 ? _mm256_castsi256_si128(hi_v) : _mm256_extracti128_si256(hi_v, 1))};
+
+				// ((hi - 0xD800) << 10) + (lo - 0xDC00) + 0x10000
+				const __m256i full {_mm256_sub_epi32(_mm256_add_epi32(_mm256_slli_epi32(code, 10), pair), _mm256_set1_epi32(0x35FDC00))};
+
+				out += __store32__(out, _mm256_blendv_epi8(code, full, lead), (keep >> i) & 0xFF);
+			}
+			ptr += size;
+		}
+		head = ptr;
+		dest = out;
+	}
+
+	// counts the code points of well-formed UTF-8, 32 bytes per iteration; stops at the first malformed block.
+	TARGET(AVX2) static inline auto __count8__(const char8_t*& head, const char8_t* tail) noexcept -> size_t
+	{
+		const char8_t* ptr {head};
+		/*&*/ size_t out {0};
+
+		// continuation bytes the last block's final lead needs from this one
+		uint64_t carry {0};
+
+		for (; 32 <= tail - ptr; ptr += 32)
+		{
+			const __m256i a {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr))};
+
+			const uint64_t hi {static_cast<uint32_t>(_mm256_movemask_epi8(a))};
+
+			if ((hi | carry) == 0)
+			{
+				out += 32; continue;
+			}
+
+			const uint64_t c  {static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(_mm256_set1_epi8(-64), a)))};
+			const uint64_t l3 {static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(a, _mm256_set1_epi8(-33)))) & hi};
+			const uint64_t l4 {static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(a, _mm256_set1_epi8(-17)))) & hi};
+
+			const uint64_t lead {~c & 0xFFFFFFFF};
+			const uint64_t l2 {hi & lead};
+
+			// continuation bytes every lead needs; those past the 32nd byte carry into the next block
+			const uint64_t must {(l2 << 1) | (l3 << 2) | (l4 << 3)};
+
+			// malformed; leave it to the scalar path
+			if (c != ((must & 0xFFFFFFFF) | carry)) break;
+
+			carry = must >> 32;
+			out += std::popcount(lead);
+		}
+
+		// hand over a sequence cut by the last block to the scalar path
+		if (carry != 0)
+		{
+			do { --ptr; } while ((*ptr & 0xC0) == 0x80); --out;
+		}
+		head = ptr;
+		return out;
+	}
+
+	// counts the code points of well-formed UTF-16, 16 code units per iteration; stops at the first malformed block.
+	TARGET(AVX2) static inline auto __count16__(const char16_t*& head, const char16_t* tail) noexcept -> size_t
+	{
+		const char16_t* ptr {head};
+		/*&*/ size_t out {0};
+
+		// the low surrogate the last block's final code unit needs from this one
+		uint32_t carry {0};
+
+		for (; 16 <= tail - ptr; ptr += 16)
+		{
+			const __m256i kind {_mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr)), _mm256_set1_epi16(static_cast<int16_t>(0xFC00)))};
+
+			// 2 bits per code unit
+			const uint32_t hi {static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(kind, _mm256_set1_epi16(static_cast<int16_t>(0xD800)))))};
+			const uint32_t lo {static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(kind, _mm256_set1_epi16(static_cast<int16_t>(0xDC00)))))};
+
+			// malformed; leave it to the scalar path
+			if (lo != ((hi << 2) | carry)) break;
+
+			carry = hi >> 30;
+			out += 16 - std::popcount(lo) / 2;
+		}
+
+		// hand over a pair cut by the last block to the scalar path
+		if (carry != 0)
+		{
+			--ptr; --out;
+		}
+		head = ptr;
+		return out;
+	}
+
+	// validates UTF-8, 32 bytes per iteration; stops before the block holding the first ill-formed sequence.
+	TARGET(AVX2) static inline auto __check8__(const char8_t*& head, const char8_t* tail) noexcept -> void
+	{
+		const char8_t* ptr {head};
+
+		const __m256i hi1 {_mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(sse42::__utf8ck__.hi1)))};
+		const __m256i lo1 {_mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(sse42::__utf8ck__.lo1)))};
+		const __m256i hi2 {_mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(sse42::__utf8ck__.hi2)))};
+		const __m256i end {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(sse42::__utf8ck__.end + 32))};
+
+		const __m256i nib {_mm256_set1_epi8(0x0F)};
+
+		// the last block, and whether it left a sequence open
+		__m256i prev {_mm256_setzero_si256()};
+		__m256i open {_mm256_setzero_si256()};
+
+		for (; 32 <= tail - ptr; ptr += 32)
+		{
+			const __m256i a {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr))};
+
+			if (_mm256_movemask_epi8(a) == 0)
+			{
+				// ill-formed; an ASCII block cannot finish what the last one opened
+				if (!_mm256_testz_si256(open, open)) break;
+
+				prev = a; continue;
+			}
+
+			// the last 16 bytes before each lane
+			const __m256i back {_mm256_permute2x128_si256(prev, a, 0x21)};
+
+			const __m256i prev1 {_mm256_alignr_epi8(a, back, 16 - 1)};
+			const __m256i prev2 {_mm256_alignr_epi8(a, back, 16 - 2)};
+			const __m256i prev3 {_mm256_alignr_epi8(a, back, 16 - 3)};
+
+			const __m256i pair {_mm256_and_si256(_mm256_and_si256(_mm256_shuffle_epi8(hi1, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nib)),
+			                                                      _mm256_shuffle_epi8(lo1, _mm256_and_si256(prev1, nib))),
+			                                     _mm256_shuffle_epi8(hi2, _mm256_and_si256(_mm256_srli_epi16(a, 4), nib)))};
+
+			// the 3rd and 4th byte of a sequence must be continuations, which the pair lookup flags as TWO_CONTS
+			const __m256i must {_mm256_and_si256(_mm256_or_si256(_mm256_subs_epu8(prev2, _mm256_set1_epi8(0xE0 - 0x80)),
+			                                                     _mm256_subs_epu8(prev3, _mm256_set1_epi8(0xF0 - 0x80))),
+			                                     _mm256_set1_epi8(static_cast<char>(0x80)))};
+
+			const __m256i bad {_mm256_xor_si256(must, pair)};
+
+			// ill-formed; leave it to the scalar path
+			if (!_mm256_testz_si256(bad, bad)) break;
+
+			prev = a;
+			open = _mm256_subs_epu8(a, end);
+		}
+
+		// hand over the sequence the stop may have cut to the scalar path; all before it is well-formed
+		if (head < ptr && 0x80 <= ptr[-1])
+		{
+			do { --ptr; } while ((*ptr & 0xC0) == 0x80);
+		}
+		head = ptr;
+	}
+
+	// validates UTF-32, 16 code points per iteration; stops before the block holding the first ill-formed code point.
+	TARGET(AVX2) static inline auto __check32__(const char32_t*& head, const char32_t* tail) noexcept -> void
+	{
+		const char32_t* ptr {head};
+
+		for (; 16 <= tail - ptr; ptr += 16)
+		{
+			const __m256i a {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + 0))};
+			const __m256i b {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + 8))};
+
+			// U+D800...U+DFFF, once the low 11 bits are gone
+			const __m256i s {_mm256_or_si256(_mm256_cmpeq_epi32(_mm256_and_si256(a, _mm256_set1_epi32(static_cast<int32_t>(0xFFFFF800))), _mm256_set1_epi32(0xD800)),
+			                                 _mm256_cmpeq_epi32(_mm256_and_si256(b, _mm256_set1_epi32(static_cast<int32_t>(0xFFFFF800))), _mm256_set1_epi32(0xD800)))};
+
+			// ill-formed; leave it to the scalar path
+			if (!__valid__(a, b) || !_mm256_testz_si256(s, s)) break;
+		}
+		head = ptr;
+	}
+
+	// validates ASCII, 32 bytes per iteration; stops before the block holding the first byte past 0x7F.
+	TARGET(AVX2) static inline auto __check7__(const char*& head, const char* tail) noexcept -> void
+	{
+		const char* ptr {head};
+
+		for (; 32 <= tail - ptr; ptr += 32)
+		{
+			// ill-formed; leave it to the scalar path
+			if (_mm256_movemask_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr))) != 0) break;
+		}
+		head = ptr;
+	}
+
+	// broadcasts a code unit to every lane.
+	template <typename T> TARGET(AVX2) static inline auto __splat__(T unit) noexcept -> __m256i
+	{
+		if constexpr (sizeof(T) == 1) { return _mm256_set1_epi8(static_cast<char>(unit)); }
+		if constexpr (sizeof(T) == 2) { return _mm256_set1_epi16(static_cast<int16_t>(unit)); }
+		if constexpr (sizeof(T) == 4) { return _mm256_set1_epi32(static_cast<int32_t>(unit)); }
+	}
+
+	// compares code units lane by lane; returns a byte mask, one bit per unit.
+	template <typename T> TARGET(AVX2) static inline auto __cmpeq__(__m256i a, __m256i b, __m256i c, __m256i d) noexcept -> uint32_t
+	{
+		if constexpr (sizeof(T) == 1) { return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(a, b), _mm256_cmpeq_epi8(c, d)))) & 0xFFFFFFFF; }
+		if constexpr (sizeof(T) == 2) { return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi16(a, b), _mm256_cmpeq_epi16(c, d)))) & 0x55555555; }
+		if constexpr (sizeof(T) == 4) { return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi32(a, b), _mm256_cmpeq_epi32(c, d)))) & 0x11111111; }
+	}
+
+	// finds a needle of 2+ units by its 1st and last unit, 32 bytes of candidates per iteration; returns the match or nullptr.
+	// false candidates spend 'credit' and every block earns some back; once it runs dry, the rest is left to the scalar path.
+	template <typename T> TARGET(AVX2) static inline auto __find__(const T*& head, const T* tail, const T* rhs, size_t len, ptrdiff_t& credit) noexcept -> const T*
+	{
+		constexpr const size_t W {32 / sizeof(T)};
+
+		const __m256i first {__splat__<T>(rhs[0])};
+		const __m256i last {__splat__<T>(rhs[len - 1])};
+
+		const T* ptr {head};
+
+		for (; 0 <= credit && W + len - 1 <= static_cast<size_t>(tail - ptr); ptr += W, credit += (W + 7) / 8)
+		{
+			const __m256i a {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr))};
+			const __m256i b {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + len - 1))};
+
+			for (uint32_t mask {__cmpeq__<T>(a, first, b, last)}; mask != 0; mask &= mask - 1, --credit)
+			{
+				const T* hit {ptr + std::countr_zero(mask) / sizeof(T)};
+
+				if (std::equal(rhs + 1, rhs + len - 1, hit + 1)) { head = hit; return hit; }
+			}
+		}
+		head = ptr; return nullptr;
+	}
+
+	// transcodes as far as this tier's kernels reach.
+	template <typename T, typename U> TARGET(AVX2) static inline auto __vcopy__(const U*& head, const U* tail, T*& dest) noexcept -> void
+	{
+		if constexpr (std::is_same_v<U, char8_t> && std::is_same_v<T, char16_t>) { __utf8to16__(head, tail, dest); }
+		if constexpr (std::is_same_v<U, char16_t> && std::is_same_v<T, char8_t>) { __utf16to8__(head, tail, dest); }
+		if constexpr (std::is_same_v<U, char8_t> && std::is_same_v<T, char32_t>) { __utf8to32__(head, tail, dest); }
+		if constexpr (std::is_same_v<U, char32_t> && std::is_same_v<T, char8_t>) { __utf32to8__(head, tail, dest); }
+		if constexpr (std::is_same_v<U, char16_t> && std::is_same_v<T, char32_t>) { __utf16to32__(head, tail, dest); }
+		if constexpr (std::is_same_v<U, char32_t> && std::is_same_v<T, char16_t>) { __utf32to16__(head, tail, dest); }
+	}
+
+	// counts as far as this tier's kernels reach.
+	template <typename T> TARGET(AVX2) static inline auto __difcp__(const T*& head, const T* tail) noexcept -> size_t
+	{
+		if constexpr (sizeof(T) == 1) { return __count8__(head, tail); }
+		if constexpr (sizeof(T) == 2) { return __count16__(head, tail); }
+	}
+
+	// validates as far as this tier's kernels reach; the count of UTF-16 stops at the first unpaired surrogate.
+	template <typename T> TARGET(AVX2) static inline auto __check__(const T*& head, const T* tail) noexcept -> void
+	{
+		if constexpr (std::is_same_v<T, char>) { __check7__(head, tail); }
+		if constexpr (std::is_same_v<T, char8_t>) { __check8__(head, tail); }
+		if constexpr (std::is_same_v<T, char16_t>) { __count16__(head, tail); }
+		if constexpr (std::is_same_v<T, char32_t>) { __check32__(head, tail); }
+	}
+}
+
+#endif//X86_64
+
+#pragma endregion SIMD::AVX2
+#pragma region SIMD::AVX512
+
+#if X86_64
+
+namespace detail::avx512
+{
+	// widens/narrows ASCII code units, 64 per iteration; returns the number of units copied.
+	template <typename T, typename U> TARGET(AVX512) static inline auto __ascii__(const U* head, const U* tail, T* dest) noexcept -> size_t
+	{
+		const U* ptr {head};
+
+		for (; 64 <= tail - ptr; ptr += 64, dest += 64)
+		{
+			__m512i bytes;
+
+			if constexpr (sizeof(U) == 1)
+			{
+				bytes = _mm512_loadu_si512(ptr + 0);
+
+				if (_mm512_movepi8_mask(bytes) != 0) break;
+			}
+			if constexpr (sizeof(U) == 2)
+			{
+				const __m512i a {_mm512_loadu_si512(ptr + 0x00)};
+				const __m512i b {_mm512_loadu_si512(ptr + 0x20)};
+
+				if (_mm512_test_epi16_mask(_mm512_or_si512(a, b), _mm512_set1_epi16(static_cast<int16_t>(0xFF80))) != 0) break;
+
+				bytes = _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvtepi16_epi8(a)), _mm512_cvtepi16_epi8(b), 1);
+			}
+			if constexpr (sizeof(U) == 4)
+			{
+				const __m512i a {_mm512_loadu_si512(ptr + 0x00)};
+				const __m512i b {_mm512_loadu_si512(ptr + 0x10)};
+				const __m512i c {_mm512_loadu_si512(ptr + 0x20)};
+				const __m512i d {_mm512_loadu_si512(ptr + 0x30)};
+
+				if (_mm512_test_epi32_mask(_mm512_or_si512(_mm512_or_si512(a, b), _mm512_or_si512(c, d)), _mm512_set1_epi32(static_cast<int32_t>(0xFFFFFF80))) != 0) break;
+
+				bytes = _mm512_castsi128_si512(_mm512_cvtepi32_epi8(a));
+				bytes = _mm512_inserti32x4(bytes, _mm512_cvtepi32_epi8(b), 1);
+				bytes = _mm512_inserti32x4(bytes, _mm512_cvtepi32_epi8(c), 2);
+				bytes = _mm512_inserti32x4(bytes, _mm512_cvtepi32_epi8(d), 3);
+			}
+
+			if constexpr (sizeof(T) == 1)
+			{
+				_mm512_storeu_si512(dest + 0, bytes);
+			}
+			if constexpr (sizeof(T) == 2)
+			{
+				_mm512_storeu_si512(dest + 0x00, _mm512_cvtepu8_epi16(_mm512_extracti64x4_epi64(bytes, 0)));
+				_mm512_storeu_si512(dest + 0x20, _mm512_cvtepu8_epi16(_mm512_extracti64x4_epi64(bytes, 1)));
+			}
+			if constexpr (sizeof(T) == 4)
+			{
+				_mm512_storeu_si512(dest + 0x00, _mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(bytes, 0)));
+				_mm512_storeu_si512(dest + 0x10, _mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(bytes, 1)));
+				_mm512_storeu_si512(dest + 0x20, _mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(bytes, 2)));
+				_mm512_storeu_si512(dest + 0x30, _mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(bytes, 3)));
+			}
+		}
+		return ptr - head;
+	}
+
+	// decodes the sequences starting at data[0...31] into 32 code units; see sse42::__decode16__.
+	TARGET(AVX512) static inline auto __decode16__(const char8_t* data, __mmask32 pair) noexcept -> __m512i
+	{
+		const __m512i b0 {_mm512_cvtepu8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 0)))};
+		const __m512i b1 {_mm512_and_si512(_mm512_cvtepu8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 1))), _mm512_set1_epi16(0x3F))};
+		const __m512i b2 {_mm512_and_si512(_mm512_cvtepu8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 2))), _mm512_set1_epi16(0x3F))};
+
+		// the 16-bit shift drops what is left of the lead's prefix
+		const __m512i c2 {_mm512_or_si512(_mm512_slli_epi16(_mm512_and_si512(b0, _mm512_set1_epi16(0x1F)), 6), b1)};
+		const __m512i c3 {_mm512_or_si512(_mm512_or_si512(_mm512_slli_epi16(b0, 12), _mm512_slli_epi16(b1, 6)), b2)};
+
+		const __m512i hi {_mm512_or_si512(_mm512_sub_epi16(_mm512_or_si512(_mm512_or_si512(_mm512_slli_epi16(_mm512_and_si512(b0, _mm512_set1_epi16(0x07)), 8),
+		                                                                                    _mm512_slli_epi16(b1, 2)),
+		                                                                    _mm512_srli_epi16(b2, 4)),
+		                                                   _mm512_set1_epi16(0x40)),
+		                                  _mm512_set1_epi16(static_cast<int16_t>(0xD800)))};
+
+		const __m512i lo {_mm512_or_si512(_mm512_or_si512(_mm512_slli_epi16(_mm512_and_si512(b1, _mm512_set1_epi16(0x0F)), 6), b2),
+		                                  _mm512_set1_epi16(static_cast<int16_t>(0xDC00)))};
+
+		__m512i code {b0};
+
+		code = _mm512_mask_mov_epi16(code, _mm512_cmpgt_epi16_mask(b0, _mm512_set1_epi16(0x7F)), c2);
+		code = _mm512_mask_mov_epi16(code, _mm512_cmpgt_epi16_mask(b0, _mm512_set1_epi16(0xDF)), c3);
+		code = _mm512_mask_mov_epi16(code, _mm512_cmpgt_epi16_mask(b0, _mm512_set1_epi16(0xEF)), hi);
+		code = _mm512_mask_mov_epi16(code, pair, lo);
+
+		return code;
+	}
+
+	// left-packs the 16-bit lanes selected by keep; returns the number of code units written.
+	TARGET(AVX512) static inline auto __store16__(char16_t* dest, __m512i code, uint32_t keep) noexcept -> size_t
+	{
+		// a 16-bit compress needs VBMI2; pack each 128-bit quarter on its own
+		const uint32_t k0 {keep >> 0x00 & 0xFF};
+		const uint32_t k1 {keep >> 0x08 & 0xFF};
+		const uint32_t k2 {keep >> 0x10 & 0xFF};
+		const uint32_t k3 {keep >> 0x18 & 0xFF};
+
+		size_t n {0};
+
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + n), _mm_shuffle_epi8(_mm512_extracti32x4_epi32(code, 0), _mm_loadu_si128(reinterpret_cast<const __m128i*>(sse42::__pack16__.mask[k0])))); n += std::popcount(k0);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + n), _mm_shuffle_epi8(_mm512_extracti32x4_epi32(code, 1), _mm_loadu_si128(reinterpret_cast<const __m128i*>(sse42::__pack16__.mask[k1])))); n += std::popcount(k1);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + n), _mm_shuffle_epi8(_mm512_extracti32x4_epi32(code, 2), _mm_loadu_si128(reinterpret_cast<const __m128i*>(sse42::__pack16__.mask[k2])))); n += std::popcount(k2);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + n), _mm_shuffle_epi8(_mm512_extracti32x4_epi32(code, 3), _mm_loadu_si128(reinterpret_cast<const __m128i*>(sse42::__pack16__.mask[k3])))); n += std::popcount(k3);
+
+		return n;
+	}
+
+	// transcodes well-formed UTF-8, 64 bytes per iteration; stops at the first malformed block.
+	TARGET(AVX512) static inline auto __utf8to16__(const char8_t*& head, const char8_t* tail, char16_t*& dest) noexcept -> void
+	{
+		const char8_t* ptr {head};
+		/*&*/ char16_t* out {dest};
+
+		// the lookahead reads up to 128 bytes, and every store stays within the output
+		// of the bytes left, which are at least a quarter of them in code units
+		for (; 256 <= tail - ptr; )
+		{
+			const __m512i a {_mm512_loadu_si512(ptr + 0x00)};
+			const __m512i b {_mm512_loadu_si512(ptr + 0x40)};
+
+			const uint64_t hi {_mm512_movepi8_mask(a)};
+
+			if (hi == 0)
+			{
+				_mm512_storeu_si512(out + 0x00, _mm512_cvtepu8_epi16(_mm512_extracti64x4_epi64(a, 0)));
+				_mm512_storeu_si512(out + 0x20, _mm512_cvtepu8_epi16(_mm512_extracti64x4_epi64(a, 1)));
+
+				ptr += 64; out += 64; continue;
+			}
+
+			const uint64_t c  {_mm512_cmplt_epi8_mask(a, _mm512_set1_epi8(-64))};
+			const uint64_t l3 {_mm512_cmpgt_epi8_mask(a, _mm512_set1_epi8(-33)) & hi};
+			const uint64_t l4 {_mm512_cmpgt_epi8_mask(a, _mm512_set1_epi8(-17)) & hi};
+			const uint64_t l5 {_mm512_cmpgt_epi8_mask(a, _mm512_set1_epi8(-9)) & hi};
+
+			const uint64_t lead {~c};
+			const uint64_t l2 {hi & lead};
+
+			// continuation bytes every lead needs; those past the 64th byte spill into the next block
+			const uint64_t must {(l2 << 1) | (l3 << 2) | (l4 << 3)};
+			const uint64_t spill {(l2 >> 63) | (l3 >> 62) | (l4 >> 61)};
+			const uint64_t size {64ull + (spill > 0) + (spill > 1) + (spill > 3) /* bit_width; up to 3 */};
+			const uint64_t span {(1ull << (size - 64)) - 1};
+
+			// malformed; leave it to the scalar path
+			if (c != must || (_mm512_cmplt_epi8_mask(b, _mm512_set1_epi8(-64)) & span) != spill || l5 != 0) break;
+
+			// 0xF0 0x80...0x8F is an overlong form that decodes below U+10000
+			if (l4 != 0 && (_mm512_cmpeq_epi8_mask(a, _mm512_set1_epi8(-16)) & _mm512_cmplt_epi8_mask(_mm512_loadu_si512(ptr + 1), _mm512_set1_epi8(-112))) != 0) break;
+
+			const uint64_t pair {l4 << 1};
+			const uint64_t keep {lead | pair};
+
+			for (uint32_t i {0}; i < 64; i += 32)
+			{
+				out += __store16__(out, __decode16__(ptr + i, static_cast<__mmask32>(pair >> i)), static_cast<uint32_t>(keep >> i));
+			}
+
+			// the low surrogate of a pair led by the last byte
+			if (l4 >> 63) *out++ = 0xDC00 | ((ptr[65] & 0x0F) << 6) | (ptr[66] & 0x3F);
+
+			ptr += size;
+		}
+		head = ptr;
+		dest = out;
+	}
+
+	// encodes 16 code units, given in 32-bit lanes along with the ones before them; see sse42::__encode8__.
+	TARGET(AVX512) static inline auto __encode8__(__m512i code, __m512i prev) noexcept -> __m512i
+	{
+		const __m512i x3F {_mm512_set1_epi32(0x3F)};
+		const __m512i x80 {_mm512_set1_epi32(0x80)};
+
+		const __m512i two {_mm512_or_si512(_mm512_or_si512(_mm512_srli_epi32(code, 6), _mm512_set1_epi32(0xC0)),
+		                                   _mm512_slli_epi32(_mm512_or_si512(_mm512_and_si512(code, x3F), x80), 8))};
+
+		const __m512i three {_mm512_or_si512(_mm512_or_si512(_mm512_srli_epi32(code, 12), _mm512_set1_epi32(0xE0)),
+		                                     _mm512_or_si512(_mm512_slli_epi32(_mm512_or_si512(_mm512_and_si512(_mm512_srli_epi32(code, 6), x3F), x80), 8),
+		                                                     _mm512_slli_epi32(_mm512_or_si512(_mm512_and_si512(code, x3F), x80), 16)))};
+
+		// a surrogate pair splits its 4 bytes over its 2 code units
+		const __m512i w {_mm512_add_epi32(_mm512_and_si512(code, _mm512_set1_epi32(0x3FF)), _mm512_set1_epi32(0x40))};
+
+		const __m512i hi {_mm512_or_si512(_mm512_or_si512(_mm512_srli_epi32(w, 8), _mm512_set1_epi32(0xF0)),
+		                                  _mm512_slli_epi32(_mm512_or_si512(_mm512_and_si512(_mm512_srli_epi32(w, 2), x3F), x80), 8))};
+
+		const __m512i lo {_mm512_or_si512(_mm512_or_si512(_mm512_or_si512(_mm512_slli_epi32(_mm512_and_si512(prev, _mm512_set1_epi32(0x03)), 4),
+		                                                                  _mm512_and_si512(_mm512_srli_epi32(code, 6), _mm512_set1_epi32(0x0F))), x80),
+		                                  _mm512_slli_epi32(_mm512_or_si512(_mm512_and_si512(code, x3F), x80), 8))};
+
+		const __m512i kind {_mm512_and_si512(code, _mm512_set1_epi32(0xFC00))};
+
+		__m512i out {code};
+
+		out = _mm512_mask_mov_epi32(out, _mm512_cmpgt_epi32_mask(code, _mm512_set1_epi32(0x07F)), two);
+		out = _mm512_mask_mov_epi32(out, _mm512_cmpgt_epi32_mask(code, _mm512_set1_epi32(0x7FF)), three);
+		out = _mm512_mask_mov_epi32(out, _mm512_cmpeq_epi32_mask(kind, _mm512_set1_epi32(0xD800)), hi);
+		out = _mm512_mask_mov_epi32(out, _mm512_cmpeq_epi32_mask(kind, _mm512_set1_epi32(0xDC00)), lo);
+
+		return out;
+	}
+
+	// left-packs the bytes told by 2 bits per 32-bit lane, as read by pack; returns the number of bytes written.
+	TARGET(AVX512) static inline auto __store8__(char8_t* dest, __m512i bytes, uint32_t keep, const auto& pack) noexcept -> size_t
+	{
+		const uint32_t k0 {keep >> 0x00 & 0xFF};
+		const uint32_t k1 {keep >> 0x08 & 0xFF};
+		const uint32_t k2 {keep >> 0x10 & 0xFF};
+		const uint32_t k3 {keep >> 0x18 & 0xFF};
+
+		size_t n {0};
+
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + n), _mm_shuffle_epi8(_mm512_extracti32x4_epi32(bytes, 0), _mm_loadu_si128(reinterpret_cast<const __m128i*>(pack.mask[k0])))); n += pack.size[k0];
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + n), _mm_shuffle_epi8(_mm512_extracti32x4_epi32(bytes, 1), _mm_loadu_si128(reinterpret_cast<const __m128i*>(pack.mask[k1])))); n += pack.size[k1];
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + n), _mm_shuffle_epi8(_mm512_extracti32x4_epi32(bytes, 2), _mm_loadu_si128(reinterpret_cast<const __m128i*>(pack.mask[k2])))); n += pack.size[k2];
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + n), _mm_shuffle_epi8(_mm512_extracti32x4_epi32(bytes, 3), _mm_loadu_si128(reinterpret_cast<const __m128i*>(pack.mask[k3])))); n += pack.size[k3];
+
+		return n;
+	}
+
+	// transcodes well-formed UTF-16, 32 code units per iteration; stops at the first malformed block.
+	TARGET(AVX512) static inline auto __utf16to8__(const char16_t*& head, const char16_t* tail, char8_t*& dest) noexcept -> void
+	{
+		const char16_t* ptr {head};
+		/*&*/ char8_t* out {dest};
+
+		// every store stays within the output of the code units left, which are at least as many in bytes
+		for (; 128 <= tail - ptr; )
+		{
+			const __m512i v {_mm512_loadu_si512(ptr)};
+
+			const uint32_t b80 {_mm512_test_epi16_mask(v, _mm512_set1_epi16(static_cast<int16_t>(0xFF80)))};
+
+			if (b80 == 0)
+			{
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out), _mm512_cvtepi16_epi8(v));
+
+				ptr += 32; out += 32; continue;
+			}
+
+			const uint32_t b800 {_mm512_test_epi16_mask(v, _mm512_set1_epi16(static_cast<int16_t>(0xF800)))};
+
+			const __m512i kind {_mm512_and_si512(v, _mm512_set1_epi16(static_cast<int16_t>(0xFC00)))};
+
+			const uint32_t hi {_mm512_cmpeq_epi16_mask(kind, _mm512_set1_epi16(static_cast<int16_t>(0xD800)))};
+			const uint32_t lo {_mm512_cmpeq_epi16_mask(kind, _mm512_set1_epi16(static_cast<int16_t>(0xDC00)))};
+
+			// malformed; leave it to the scalar path
+			if (lo != (hi << 1)) break;
+
+			// a trailing high surrogate waits for its pair
+			const uint32_t size {32 - (hi >> 31)};
+
+			// 2 bits per code unit
+			const uint64_t keep {(0x5555555555555555 + _pdep_u64(b80, 0x5555555555555555) + _pdep_u64(b800 & ~(hi | lo), 0x5555555555555555)) & (size == 32 ? ~0ull : ~0ull >> 2)};
+
+			const __m512i lo_code {_mm512_cvtepu16_epi32(_mm512_extracti64x4_epi64(v, 0))};
+			const __m512i hi_code {_mm512_cvtepu16_epi32(_mm512_extracti64x4_epi64(v, 1))};
+
+			// shift in the code unit before each lane
+			const __m512i lo_back {_mm512_alignr_epi32(lo_code, _mm512_setzero_si512(), 15)};
+			const __m512i hi_back {_mm512_alignr_epi32(hi_code, lo_code, 15)};
+
+			out += __store8__(out, __encode8__(lo_code, lo_back), static_cast<uint32_t>(keep >> 0x00), sse42::__pack8__);
+			out += __store8__(out, __encode8__(hi_code, hi_back), static_cast<uint32_t>(keep >> 0x20), sse42::__pack8__);
+
+			ptr += size;
+		}
+		head = ptr;
+		dest = out;
+	}
+
+	// decodes the sequences starting at data[0...15] into 16 code points; see sse42::__decode32__.
+	TARGET(AVX512) static inline auto __decode32__(const char8_t* data) noexcept -> __m512i
+	{
+		const __m512i b0 {_mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0)))};
+		const __m512i b1 {_mm512_and_si512(_mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 1))), _mm512_set1_epi32(0x3F))};
+		const __m512i b2 {_mm512_and_si512(_mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 2))), _mm512_set1_epi32(0x3F))};
+		const __m512i b3 {_mm512_and_si512(_mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 3))), _mm512_set1_epi32(0x3F))};
+
+		const __m512i c2 {_mm512_or_si512(_mm512_slli_epi32(_mm512_and_si512(b0, _mm512_set1_epi32(0x1F)), 6), b1)};
+		const __m512i c3 {_mm512_or_si512(_mm512_or_si512(_mm512_slli_epi32(_mm512_and_si512(b0, _mm512_set1_epi32(0x0F)), 12), _mm512_slli_epi32(b1, 6)), b2)};
+		const __m512i c4 {_mm512_or_si512(_mm512_or_si512(_mm512_slli_epi32(_mm512_and_si512(b0, _mm512_set1_epi32(0x07)), 18), _mm512_slli_epi32(b1, 12)),
+		                                  _mm512_or_si512(_mm512_slli_epi32(b2, 6), b3))};
+
+		__m512i code {b0};
+
+		code = _mm512_mask_mov_epi32(code, _mm512_cmpgt_epi32_mask(b0, _mm512_set1_epi32(0x7F)), c2);
+		code = _mm512_mask_mov_epi32(code, _mm512_cmpgt_epi32_mask(b0, _mm512_set1_epi32(0xDF)), c3);
+		code = _mm512_mask_mov_epi32(code, _mm512_cmpgt_epi32_mask(b0, _mm512_set1_epi32(0xEF)), c4);
+
+		return code;
+	}
+
+	// left-packs the 32-bit lanes selected by keep; returns the number of code points written.
+	TARGET(AVX512) static inline auto __store32__(char32_t* dest, __m512i code, uint32_t keep) noexcept -> size_t
+	{
+		// a compress into a register, as compressing straight to memory is microcoded on some cores
+		_mm512_storeu_si512(dest, _mm512_maskz_compress_epi32(static_cast<__mmask16>(keep), code));
+
+		return std::popcount(keep);
+	}
+
+	// transcodes well-formed UTF-8, 64 bytes per iteration; stops at the first malformed block.
+	TARGET(AVX512) static inline auto __utf8to32__(const char8_t*& head, const char8_t* tail, char32_t*& dest) noexcept -> void
+	{
+		const char8_t* ptr {head};
+		/*&*/ char32_t* out {dest};
+
+		// the lookahead reads up to 128 bytes, and every store stays within the output
+		// of the bytes left, which are at least a quarter of them in code points
+		for (; 256 <= tail - ptr; )
+		{
+			const __m512i a {_mm512_loadu_si512(ptr + 0x00)};
+			const __m512i b {_mm512_loadu_si512(ptr + 0x40)};
+
+			const uint64_t hi {_mm512_movepi8_mask(a)};
+
+			if (hi == 0)
+			{
+				_mm512_storeu_si512(out + 0x00, _mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(a, 0)));
+				_mm512_storeu_si512(out + 0x10, _mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(a, 1)));
+				_mm512_storeu_si512(out + 0x20, _mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(a, 2)));
+				_mm512_storeu_si512(out + 0x30, _mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(a, 3)));
+
+				ptr += 64; out += 64; continue;
+			}
+
+			const uint64_t c  {_mm512_cmplt_epi8_mask(a, _mm512_set1_epi8(-64))};
+			const uint64_t l3 {_mm512_cmpgt_epi8_mask(a, _mm512_set1_epi8(-33)) & hi};
+			const uint64_t l4 {_mm512_cmpgt_epi8_mask(a, _mm512_set1_epi8(-17)) & hi};
+			const uint64_t l5 {_mm512_cmpgt_epi8_mask(a, _mm512_set1_epi8(-9)) & hi};
+
+			const uint64_t lead {~c};
+			const uint64_t l2 {hi & lead};
+
+			// continuation bytes every lead needs; those past the 64th byte spill into the next block
+			const uint64_t must {(l2 << 1) | (l3 << 2) | (l4 << 3)};
+			const uint64_t spill {(l2 >> 63) | (l3 >> 62) | (l4 >> 61)};
+			const uint64_t size {64ull + (spill > 0) + (spill > 1) + (spill > 3) /* bit_width; up to 3 */};
+			const uint64_t span {(1ull << (size - 64)) - 1};
+
+			// malformed; leave it to the scalar path (overlong forms decode just like there)
+			if (c != must || (_mm512_cmplt_epi8_mask(b, _mm512_set1_epi8(-64)) & span) != spill || l5 != 0) break;
+
+			for (uint32_t i {0}; i < 64; i += 16)
+			{
+				out += __store32__(out, __decode32__(ptr + i), static_cast<uint32_t>(lead >> i) & 0xFFFF);
+			}
+			ptr += size;
+		}
+		head = ptr;
+		dest = out;
+	}
+
+	// encodes 16 code points into 1...4 bytes per lane; see sse42::__encode8__.
+	TARGET(AVX512) static inline auto __encode8__(__m512i code) noexcept -> __m512i
+	{
+		const __m512i x3F {_mm512_set1_epi32(0x3F)};
+		const __m512i x80 {_mm512_set1_epi32(0x80)};
+
+		// continuation bytes, last to first
+		const __m512i t0 {_mm512_or_si512(_mm512_and_si512(code, x3F), x80)};
+		const __m512i t1 {_mm512_or_si512(_mm512_and_si512(_mm512_srli_epi32(code, 06), x3F), x80)};
+		const __m512i t2 {_mm512_or_si512(_mm512_and_si512(_mm512_srli_epi32(code, 12), x3F), x80)};
+
+		const __m512i two {_mm512_or_si512(_mm512_or_si512(_mm512_srli_epi32(code, 06), _mm512_set1_epi32(0xC0)), _mm512_slli_epi32(t0, 8))};
+
+		const __m512i three {_mm512_or_si512(_mm512_or_si512(_mm512_srli_epi32(code, 12), _mm512_set1_epi32(0xE0)),
+		                                     _mm512_or_si512(_mm512_slli_epi32(t1, 8), _mm512_slli_epi32(t0, 16)))};
+
+		const __m512i four {_mm512_or_si512(_mm512_or_si512(_mm512_or_si512(_mm512_srli_epi32(code, 18), _mm512_set1_epi32(0xF0)), _mm512_slli_epi32(t2, 8)),
+		                                    _mm512_or_si512(_mm512_slli_epi32(t1, 16), _mm512_slli_epi32(t0, 24)))};
+
+		__m512i out {code};
+
+		out = _mm512_mask_mov_epi32(out, _mm512_cmpgt_epi32_mask(code, _mm512_set1_epi32(0x00007F)), two);
+		out = _mm512_mask_mov_epi32(out, _mm512_cmpgt_epi32_mask(code, _mm512_set1_epi32(0x0007FF)), three);
+		out = _mm512_mask_mov_epi32(out, _mm512_cmpgt_epi32_mask(code, _mm512_set1_epi32(0x00FFFF)), four);
+
+		return out;
+	}
+
+	// whether every lane of both vectors is a code point up to U+10FFFF.
+	TARGET(AVX512) static inline auto __valid__(__m512i a, __m512i b) noexcept -> bool
+	{
+		return _mm512_cmpgt_epu32_mask(_mm512_max_epu32(a, b), _mm512_set1_epi32(0x10FFFF)) == 0;
+	}
+
+	// transcodes well-formed UTF-32, 32 code points per iteration; stops at the first malformed block.
+	TARGET(AVX512) static inline auto __utf32to8__(const char32_t*& head, const char32_t* tail, char8_t*& dest) noexcept -> void
+	{
+		const char32_t* ptr {head};
+		/*&*/ char8_t* out {dest};
+
+		// every store stays within the output of the code points left, which are at least as many in bytes
+		for (; 128 <= tail - ptr; )
+		{
+			const __m512i a {_mm512_loadu_si512(ptr + 0x00)};
+			const __m512i b {_mm512_loadu_si512(ptr + 0x10)};
+
+			if (_mm512_test_epi32_mask(_mm512_or_si512(a, b), _mm512_set1_epi32(static_cast<int32_t>(0xFFFFFF80))) == 0)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + 0x00), _mm512_cvtepi32_epi8(a));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + 0x10), _mm512_cvtepi32_epi8(b));
+
+				ptr += 32; out += 32; continue;
+			}
+
+			// malformed; leave it to the scalar path
+			if (!__valid__(a, b)) break;
+
+			for (uint32_t i {0}; i < 32; i += 16)
+			{
+				const __m512i code {i == 0 ? a : b};
+
+				// the number of bytes past the first, 2 bits per lane
+				const uint32_t keep {_pdep_u32(_mm512_cmpgt_epi32_mask(code, _mm512_set1_epi32(0x00007F)), 0x55555555)
+				                     +
+				                     _pdep_u32(_mm512_cmpgt_epi32_mask(code, _mm512_set1_epi32(0x0007FF)), 0x55555555)
+				                     +
+				                     _pdep_u32(_mm512_cmpgt_epi32_mask(code, _mm512_set1_epi32(0x00FFFF)), 0x55555555)};
+
+				out += __store8__(out, __encode8__(code), keep, sse42::__pack4__);
+			}
+			ptr += 32;
+		}
+		head = ptr;
+		dest = out;
+	}
+
+	// transcodes well-formed UTF-32, 32 code points per iteration; stops at the first malformed block.
+	TARGET(AVX512) static inline auto __utf32to16__(const char32_t*& head, const char32_t* tail, char16_t*& dest) noexcept -> void
+	{
+		const char32_t* ptr {head};
+		/*&*/ char16_t* out {dest};
+
+		// every store stays within the output of the code points left, which are at least as many in code units
+		for (; 64 <= tail - ptr; )
+		{
+			const __m512i a {_mm512_loadu_si512(ptr + 0x00)};
+			const __m512i b {_mm512_loadu_si512(ptr + 0x10)};
+
+			if (_mm512_test_epi32_mask(_mm512_or_si512(a, b), _mm512_set1_epi32(static_cast<int32_t>(0xFFFF0000))) == 0)
+			{
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0x00), _mm512_cvtepi32_epi16(a));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0x10), _mm512_cvtepi32_epi16(b));
+
+				ptr += 32; out += 32; continue;
+			}
+
+			// malformed; leave it to the scalar path
+			if (!__valid__(a, b)) break;
+
+			for (uint32_t i {0}; i < 32; i += 16)
+			{
+				const __m512i code {i == 0 ? a : b};
+				const __mmask16 wide {_mm512_cmpgt_epi32_mask(code, _mm512_set1_epi32(0xFFFF))};
+
+				// a pair puts its high surrogate in the low half of the lane
+				const __m512i w {_mm512_sub_epi32(code, _mm512_set1_epi32(0x10000))};
+
+				const __m512i pair {_mm512_or_si512(_mm512_or_si512(_mm512_srli_epi32(w, 10), _mm512_set1_epi32(0xD800)),
+				                                    _mm512_slli_epi32(_mm512_or_si512(_mm512_and_si512(w, _mm512_set1_epi32(0x3FF)), _mm512_set1_epi32(0xDC00)), 16))};
+
+				// the low half of every lane, and the high half of a pair
+				const uint32_t keep {0x55555555 | _pdep_u32(wide, 0xAAAAAAAA)};
+
+				out += __store16__(out, _mm512_mask_mov_epi32(code, wide, pair), keep);
+			}
+			ptr += 32;
+		}
+		head = ptr;
+		dest = out;
+	}
+
+	// transcodes well-formed UTF-16, 32 code units per iteration; stops at the first malformed block.
+	TARGET(AVX512) static inline auto __utf16to32__(const char16_t*& head, const char16_t* tail, char32_t*& dest) noexcept -> void
+	{
+		const char16_t* ptr {head};
+		/*&*/ char32_t* out {dest};
+
+		// every store stays within the output of the code units left, which are at least half as many in code points
+		for (; 128 <= tail - ptr; )
+		{
+			const __m512i v {_mm512_loadu_si512(ptr)};
+
+			const __m512i lo_code {_mm512_cvtepu16_epi32(_mm512_extracti64x4_epi64(v, 0))};
+			const __m512i hi_code {_mm512_cvtepu16_epi32(_mm512_extracti64x4_epi64(v, 1))};
+
+			if (_mm512_cmpeq_epi16_mask(_mm512_and_si512(v, _mm512_set1_epi16(static_cast<int16_t>(0xF800))), _mm512_set1_epi16(static_cast<int16_t>(0xD800))) == 0)
+			{
+				_mm512_storeu_si512(out + 0x00, lo_code);
+				_mm512_storeu_si512(out + 0x10, hi_code);
+
+				ptr += 32; out += 32; continue;
+			}
+
+			const __m512i kind {_mm512_and_si512(v, _mm512_set1_epi16(static_cast<int16_t>(0xFC00)))};
+
+			const uint32_t hi {_mm512_cmpeq_epi16_mask(kind, _mm512_set1_epi16(static_cast<int16_t>(0xD800)))};
+			const uint32_t lo {_mm512_cmpeq_epi16_mask(kind, _mm512_set1_epi16(static_cast<int16_t>(0xDC00)))};
+
+			// malformed; leave it to the scalar path
+			if (lo != (hi << 1)) break;
+
+			// a trailing high surrogate waits for its pair
+			const uint32_t size {32 - (hi >> 31)};
+
+			const uint32_t keep {~lo & (size == 32 ? 0xFFFFFFFF : 0x7FFFFFFF)};
+
+			// shift in the code unit after each lane
+			const __m512i lo_next {_mm512_alignr_epi32(hi_code, lo_code, 1)};
+			const __m512i hi_next {_mm512_alignr_epi32(_mm512_setzero_si512(), hi_code, 1)};
+
+			// ((hi - 0xD800) << 10) + (lo - 0xDC00) + 0x10000
+			const __m512i lo_full {_mm512_sub_epi32(_mm512_add_epi32(_mm512_slli_epi32(lo_code, 10), lo_next), _mm512_set1_epi32(0x35FDC00))};
+			const __m512i hi_full {_mm512_sub_epi32(_mm512_add_epi32(_mm512_slli_epi32(hi_code, 10), hi_next), _mm512_set1_epi32(0x35FDC00))};
+
+			out += __store32__(out, _mm512_mask_mov_epi32(lo_code, static_cast<__mmask16>(hi >> 0x00), lo_full), (keep >> 0x00) & 0xFFFF);
+			out += __store32__(out, _mm512_mask_mov_epi32(hi_code, static_cast<__mmask16>(hi >> 0x10), hi_full), (keep >> 0x10) & 0xFFFF);
+
+			ptr += size;
+		}
+		head = ptr;
+		dest = out;
+	}
+
+	// counts the code points of well-formed UTF-8, 64 bytes per iteration; stops at the first malformed block.
+	TARGET(AVX512) static inline auto __count8__(const char8_t*& head, const char8_t* tail) noexcept -> size_t
+	{
+		const char8_t* ptr {head};
+		/*&*/ size_t out {0};
+
+		// continuation bytes the last block's final lead needs from this one
+		uint64_t carry {0};
+
+		for (; 64 <= tail - ptr; ptr += 64)
+		{
+			const __m512i a {_mm512_loadu_si512(ptr)};
+
+			const uint64_t hi {_mm512_movepi8_mask(a)};
+
+			if ((hi | carry) == 0)
+			{
+				out += 64; continue;
+			}
+
+			const uint64_t c  {_mm512_cmplt_epi8_mask(a, _mm512_set1_epi8(-64))};
+			const uint64_t l3 {_mm512_cmpgt_epi8_mask(a, _mm512_set1_epi8(-33)) & hi};
+			const uint64_t l4 {_mm512_cmpgt_epi8_mask(a, _mm512_set1_epi8(-17)) & hi};
+
+			const uint64_t lead {~c};
+			const uint64_t l2 {hi & lead};
+
+			// continuation bytes every lead needs; those past the 64th byte carry into the next block
+			const uint64_t must {(l2 << 1) | (l3 << 2) | (l4 << 3)};
+
+			// malformed; leave it to the scalar path
+			if (c != (must | carry)) break;
+
+			carry = (l2 >> 63) | (l3 >> 62) | (l4 >> 61);
+			out += std::popcount(lead);
+		}
+
+		// hand over a sequence cut by the last block to the scalar path
+		if (carry != 0)
+		{
+			do { --ptr; } while ((*ptr & 0xC0) == 0x80); --out;
+		}
+		head = ptr;
+		return out;
+	}
+
+	// counts the code points of well-formed UTF-16, 32 code units per iteration; stops at the first malformed block.
+	TARGET(AVX512) static inline auto __count16__(const char16_t*& head, const char16_t* tail) noexcept -> size_t
+	{
+		const char16_t* ptr {head};
+		/*&*/ size_t out {0};
+
+		// the low surrogate the last block's final code unit needs from this one
+		uint32_t carry {0};
+
+		for (; 32 <= tail - ptr; ptr += 32)
+		{
+			const __m512i kind {_mm512_and_si512(_mm512_loadu_si512(ptr), _mm512_set1_epi16(static_cast<int16_t>(0xFC00)))};
+
+			const uint32_t hi {_mm512_cmpeq_epi16_mask(kind, _mm512_set1_epi16(static_cast<int16_t>(0xD800)))};
+			const uint32_t lo {_mm512_cmpeq_epi16_mask(kind, _mm512_set1_epi16(static_cast<int16_t>(0xDC00)))};
+
+			// malformed; leave it to the scalar path
+			if (lo != ((hi << 1) | carry)) break;
+
+			carry = hi >> 31;
+			out += 32 - std::popcount(lo);
+		}
+
+		// hand over a pair cut by the last block to the scalar path
+		if (carry != 0)
+		{
+			--ptr; --out;
+		}
+		head = ptr;
+		return out;
+	}
+
+	// validates UTF-8, 64 bytes per iteration; stops before the block holding the first ill-formed sequence.
+	TARGET(AVX512) static inline auto __check8__(const char8_t*& head, const char8_t* tail) noexcept -> void
+	{
+		const char8_t* ptr {head};
+
+		const __m512i hi1 {_mm512_broadcast_i32x4(_mm_loadu_si128(reinterpret_cast<const __m128i*>(sse42::__utf8ck__.hi1)))};
+		const __m512i lo1 {_mm512_broadcast_i32x4(_mm_loadu_si128(reinterpret_cast<const __m128i*>(sse42::__utf8ck__.lo1)))};
+		const __m512i hi2 {_mm512_broadcast_i32x4(_mm_loadu_si128(reinterpret_cast<const __m128i*>(sse42::__utf8ck__.hi2)))};
+		const __m512i end {_mm512_loadu_si512(sse42::__utf8ck__.end)};
+
+		const __m512i nib {_mm512_set1_epi8(0x0F)};
+
+		// rotates the lanes up by one, pulling the last block's top lane in at the bottom
+		const __m512i rot {_mm512_setr_epi32(28, 29, 30, 31, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11)};
+
+		// the last block, and whether it left a sequence open
+		__m512i prev {_mm512_setzero_si512()};
+		__m512i open {_mm512_setzero_si512()};
+
+		for (; 64 <= tail - ptr; ptr += 64)
+		{
+			const __m512i a {_mm512_loadu_si512(ptr)};
+
+			if (_mm512_movepi8_mask(a) == 0)
+			{
+				// ill-formed; an ASCII block cannot finish what the last one opened
+				if (_mm512_test_epi8_mask(open, open) != 0) break;
+
+				prev = a; continue;
+			}
+
+			// the last 16 bytes before each lane
+			const __m512i back {_mm512_permutex2var_epi32(a, rot, prev)};
+
+			const __m512i prev1 {_mm512_alignr_epi8(a, back, 16 - 1)};
+			const __m512i prev2 {_mm512_alignr_epi8(a, back, 16 - 2)};
+			const __m512i prev3 {_mm512_alignr_epi8(a, back, 16 - 3)};
+
+			const __m512i pair {_mm512_and_si512(_mm512_and_si512(_mm512_shuffle_epi8(hi1, _mm512_and_si512(_mm512_srli_epi16(prev1, 4), nib)),
+			                                                      _mm512_shuffle_epi8(lo1, _mm512_and_si512(prev1, nib))),
+			                                     _mm512_shuffle_epi8(hi2, _mm512_and_si512(_mm512_srli_epi16(a, 4), nib)))};
+
+			// the 3rd and 4th byte of a sequence must be continuations, which the pair lookup flags as TWO_CONTS
+			const __m512i must {_mm512_and_si512(_mm512_or_si512(_mm512_subs_epu8(prev2, _mm512_set1_epi8(0xE0 - 0x80)),
+			                                                     _mm512_subs_epu8(prev3, _mm512_set1_epi8(0xF0 - 0x80))),
+			                                     _mm512_set1_epi8(static_cast<char>(0x80)))};
+
+			const __m512i bad {_mm512_xor_si512(must, pair)};
+
+			// ill-formed; leave it to the scalar path
+			if (_mm512_test_epi8_mask(bad, bad) != 0) break;
+
+			prev = a;
+			open = _mm512_subs_epu8(a, end);
+		}
+
+		// hand over the sequence the stop may have cut to the scalar path; all before it is well-formed
+		if (head < ptr && 0x80 <= ptr[-1])
+		{
+			do { --ptr; } while ((*ptr & 0xC0) == 0x80);
+		}
+		head = ptr;
+	}
+
+	// validates UTF-32, 32 code points per iteration; stops before the block holding the first ill-formed code point.
+	TARGET(AVX512) static inline auto __check32__(const char32_t*& head, const char32_t* tail) noexcept -> void
+	{
+		const char32_t* ptr {head};
+
+		for (; 32 <= tail - ptr; ptr += 32)
+		{
+			const __m512i a {_mm512_loadu_si512(ptr + 0x00)};
+			const __m512i b {_mm512_loadu_si512(ptr + 0x10)};
+
+			// U+D800...U+DFFF, once the low 11 bits are gone
+			const __mmask16 s {static_cast<__mmask16>(_mm512_cmpeq_epi32_mask(_mm512_and_si512(a, _mm512_set1_epi32(static_cast<int32_t>(0xFFFFF800))), _mm512_set1_epi32(0xD800))
+			                                          |
+			                                          _mm512_cmpeq_epi32_mask(_mm512_and_si512(b, _mm512_set1_epi32(static_cast<int32_t>(0xFFFFF800))), _mm512_set1_epi32(0xD800)))};
+
+			// ill-formed; leave it to the scalar path
+			if (!__valid__(a, b) || s != 0) break;
+		}
+		head = ptr;
+	}
+
+	// validates ASCII, 64 bytes per iteration; stops before the block holding the first byte past 0x7F.
+	TARGET(AVX512) static inline auto __check7__(const char*& head, const char* tail) noexcept -> void
+	{
+		const char* ptr {head};
+
+		for (; 64 <= tail - ptr; ptr += 64)
+		{
+			// ill-formed; leave it to the scalar path
+			if (_mm512_movepi8_mask(_mm512_loadu_si512(ptr)) != 0) break;
+		}
+		head = ptr;
+	}
+
+	// finds a needle of 2+ units by its 1st and last unit, 64 bytes of candidates per iteration; returns the match or nullptr.
+	// false candidates spend 'credit' and every block earns some back; once it runs dry, the rest is left to the scalar path.
+	template <typename T> TARGET(AVX512) static inline auto __find__(const T*& head, const T* tail, const T* rhs, size_t len, ptrdiff_t& credit) noexcept -> const T*
+	{
+		constexpr const size_t W {64 / sizeof(T)};
+
+		const T* ptr {head};
+
+		for (; 0 <= credit && W + len - 1 <= static_cast<size_t>(tail - ptr); ptr += W, credit += W / 8)
+		{
+			const __m512i a {_mm512_loadu_si512(ptr)};
+			const __m512i b {_mm512_loadu_si512(ptr + len - 1)};
+
+			uint64_t mask;
+
+			if constexpr (sizeof(T) == 1) { mask = _mm512_mask_cmpeq_epi8_mask(_mm512_cmpeq_epi8_mask(a, _mm512_set1_epi8(static_cast<char>(rhs[0]))), b, _mm512_set1_epi8(static_cast<char>(rhs[len - 1]))); }
+			if constexpr (sizeof(T) == 2) { mask = _mm512_mask_cmpeq_epi16_mask(_mm512_cmpeq_epi16_mask(a, _mm512_set1_epi16(static_cast<int16_t>(rhs[0]))), b, _mm512_set1_epi16(static_cast<int16_t>(rhs[len - 1]))); }
+			if constexpr (sizeof(T) == 4) { mask = _mm512_mask_cmpeq_epi32_mask(_mm512_cmpeq_epi32_mask(a, _mm512_set1_epi32(static_cast<int32_t>(rhs[0]))), b, _mm512_set1_epi32(static_cast<int32_t>(rhs[len - 1]))); }
+
+			for (; mask != 0; mask &= mask - 1, --credit)
+			{
+				const T* hit {ptr + std::countr_zero(mask)};
+
+				if (std::equal(rhs + 1, rhs + len - 1, hit + 1)) { head = hit; return hit; }
+			}
+		}
+		head = ptr; return nullptr;
+	}
+
+	// transcodes as far as this tier's kernels reach.
+	template <typename T, typename U> TARGET(AVX512) static inline auto __vcopy__(const U*& head, const U* tail, T*& dest) noexcept -> void
+	{
+		if constexpr (std::is_same_v<U, char8_t> && std::is_same_v<T, char16_t>) { __utf8to16__(head, tail, dest); }
+		if constexpr (std::is_same_v<U, char16_t> && std::is_same_v<T, char8_t>) { __utf16to8__(head, tail, dest); }
+		if constexpr (std::is_same_v<U, char8_t> && std::is_same_v<T, char32_t>) { __utf8to32__(head, tail, dest); }
+		if constexpr (std::is_same_v<U, char32_t> && std::is_same_v<T, char8_t>) { __utf32to8__(head, tail, dest); }
+		if constexpr (std::is_same_v<U, char16_t> && std::is_same_v<T, char32_t>) { __utf16to32__(head, tail, dest); }
+		if constexpr (std::is_same_v<U, char32_t> && std::is_same_v<T, char16_t>) { __utf32to16__(head, tail, dest); }
+	}
+
+	// counts as far as this tier's kernels reach.
+	template <typename T> TARGET(AVX512) static inline auto __difcp__(const T*& head, const T* tail) noexcept -> size_t
+	{
+		if constexpr (sizeof(T) == 1) { return __count8__(head, tail); }
+		if constexpr (sizeof(T) == 2) { return __count16__(head, tail); }
+	}
+
+	// validates as far as this tier's kernels reach; the count of UTF-16 stops at the first unpaired surrogate.
+	template <typename T> TARGET(AVX512) static inline auto __check__(const T*& head, const T* tail) noexcept -> void
+	{
+		if constexpr (std::is_same_v<T, char>) { __check7__(head, tail); }
+		if constexpr (std::is_same_v<T, char8_t>) { __check8__(head, tail); }
+		if constexpr (std::is_same_v<T, char16_t>) { __count16__(head, tail); }
+		if constexpr (std::is_same_v<T, char32_t>) { __check32__(head, tail); }
+	}
+}
+
+#endif//X86_64
+
+#pragma endregion SIMD::AVX512
+#pragma region CRTP::detail
+
+inline auto detail::__isa__() noexcept -> isa
+{
+	static const isa out {[]() noexcept -> isa
+	{
+		isa cpu {isa::SCALAR};
+		isa cap {isa::AVX512};
+
+		#if X86_64
+		uint32_t reg[4] {};
+
+		const auto cpuid {[&reg](const uint32_t leaf, const uint32_t sub) noexcept -> void
+		{
+			#if defined(_MSC_VER) && !defined(__clang__)
+			__cpuidex(reinterpret_cast<int*>(reg), static_cast<int>(leaf), static_cast<int>(sub));
+			#else
+			__cpuid_count(leaf, sub, reg[0], reg[1], reg[2], reg[3]);
+			#endif
+		}};
+
+		const auto has {[](const uint32_t bits, const uint32_t mask) noexcept -> bool
+		{
+			return (bits & mask) == mask;
+		}};
+
+		cpuid(0x00000000, 0); const uint32_t max {reg[0]};
+		cpuid(0x80000000, 0); const uint32_t ext {reg[0]};
+
+		cpuid(0x00000001, 0); const uint32_t ecx1 {reg[2]};
+
+		uint32_t ebx7 {0}; if (0x00000007 <= max) { cpuid(0x00000007, 0); ebx7 = reg[1]; }
+		uint32_t ecx8 {0}; if (0x80000001 <= ext) { cpuid(0x80000001, 0); ecx8 = reg[2]; }
+
+		uint64_t xcr0 {0};
+
+		// OS has enabled xgetbv
+		if (has(ecx1, 1u << 27))
+		{
+			#if defined(_MSC_VER) && !defined(__clang__)
+			xcr0 = _xgetbv(0);
+			#else
+			uint32_t lo, hi; __asm__ volatile ("xgetbv" : "=a" (lo), "=d" (hi) : "c" (0));
+			xcr0 = (static_cast<uint64_t>(hi) << 32) | lo;
+			#endif
+		}
+
+		// sse4.2 + popcnt
+		if (has(ecx1, 1u << 20 | 1u << 23))
+		{
+			cpu = isa::SSE42;
+		}
+		// avx + avx2 + bmi + bmi2 + lzcnt; OS saves xmm/ymm
+		if (cpu == isa::SSE42 && has(ecx1, 1u << 28) && has(ebx7, 1u << 3 | 1u << 5 | 1u << 8)
+		                      && has(ecx8, 1u << 5) && (xcr0 & 0x06) == 0x06)
+		{
+			cpu = isa::AVX2;
+		}
+		// avx512f + avx512bw + avx512vl; OS saves opmask/zmm
+		if (cpu == isa::AVX2 && has(ebx7, 1u << 16 | 1u << 30 | 1u << 31) && (xcr0 & 0xE6) == 0xE6)
+		{
+			cpu = isa::AVX512;
+		}
+		#endif//X86_64
+
+		#ifdef UTF_SIMD
+		cap = isa::UTF_SIMD;
+		#endif//UTF_SIMD
+
+		#if defined(_MSC_VER) && !defined(__clang__)
+		#pragma warning(suppress : 4996)
+		#endif
+		if (const char* env {std::getenv("UTF_SIMD")})
+		{
+			const std::string_view tier {env};
+
+			/**/ if (tier == "SCALAR") { cap = std::min(cap, isa::SCALAR); }
+			else if (tier == "SSE42") { cap = std::min(cap, isa::SSE42); }
+			else if (tier == "AVX2") { cap = std::min(cap, isa::AVX2); }
+			else if (tier == "AVX512") { cap = std::min(cap, isa::AVX512); }
+		}
+
+		// never run past what the CPU supports
+		return std::min(cpu, cap);
+	}()};
+
+	return out;
+}
+
+template <typename Codec,
+          typename Other> constexpr auto detail::__ascii__(const typename Other::T* head, const typename Other::T* tail,
+                                                                                          /*&*/ typename Codec::T* dest) noexcept -> size_t
+{
+	typedef typename Codec::T T;
+	typedef typename Other::T U;
+
+	const U* ptr {head};
+
+	if !consteval
+	{
+		#if X86_64
+		switch (__isa__())
+		{
+			// each tier hands over its leftover to the narrower one
+			case isa::AVX512:
+			{
+				const auto run {avx512::__ascii__(ptr, tail, dest)};
+				ptr += run; dest += run;
+				[[fallthrough]];
+			}
+			case isa::AVX2:
+			{
+				const auto run {avx2::__ascii__(ptr, tail, dest)};
+				ptr += run; dest += run;
+				[[fallthrough]];
+			}
+			case isa::SSE42:
+			{
+				const auto run {sse42::__ascii__(ptr, tail, dest)};
+				ptr += run; dest += run;
+				[[fallthrough]];
+			}
+			case isa::SCALAR:
+			{
+				break;
+			}
+		}
+		#endif//X86_64
+	}
+
+	for (; ptr < tail && static_cast<uint32_t>(*ptr) < 0x80; ++ptr, ++dest)
+	{
+		*dest = static_cast<T>(*ptr);
+	}
+
+	return ptr - head;
+}
+
+template <typename Codec,
+          typename Other> constexpr auto detail::__vcopy__(const typename Other::T*& head, const typename Other::T* tail,
+                                                                                          /*&*/ typename Codec::T*& dest) noexcept -> void
+{
+	if !consteval
+	{
+		#if X86_64
+		// pairs the vector kernels cover; the rest only takes the ASCII run
+		constexpr const bool kernel
+		{
+			!std::is_same_v<Codec, codec<"ASCII">>
+			&&
+			!std::is_same_v<Other, codec<"ASCII">>
+		};
+
+		if constexpr (kernel)
+		{
+			switch (__isa__())
+			{
+				// each tier hands over its leftover to the narrower one
+				case isa::AVX512:
+				{
+					avx512::__vcopy__(head, tail, dest);
+					[[fallthrough]];
+				}
+				case isa::AVX2:
+				{
+					avx2::__vcopy__(head, tail, dest);
+					[[fallthrough]];
+				}
+				case isa::SSE42:
+				{
+					sse42::__vcopy__(head, tail, dest);
+					[[fallthrough]];
+				}
+				case isa::SCALAR:
+				{
+					break;
+				}
+			}
+		}
+		#endif//X86_64
+	}
+
+	// ASCII is a subset of every codec; copy the whole run at once
+	if (head < tail && static_cast<uint32_t>(*head) < 0x80)
+	{
+		const auto run {__ascii__<Codec, Other>(head, tail, dest)};
+
+		head += run;
+		dest += run;
+	}
+}
+
+template <typename Codec> constexpr auto detail::__difcu__(const typename Codec::T* head, const typename Codec::T* tail) noexcept -> size_t
+{
+	typedef typename Codec::T T;
+
+	if constexpr (Codec::is_variable)
+	{
+		return tail - head;
+	}
+
+	if constexpr (!Codec::is_variable)
+	{
+		return tail - head;
+	}
+}
+
+template <typename Codec> constexpr auto detail::__difcp__(const typename Codec::T* head, const typename Codec::T* tail) noexcept -> size_t
+{
+	typedef typename Codec::T T;
+
+	if constexpr (Codec::is_variable)
+	{
+		size_t out {0};
+
+		for (const T* ptr {head}; ptr < tail; ++out, ptr += Codec::next(ptr))
+		{
+			if !consteval
+			{
+				#if X86_64
+				// count as much as the vector kernels allow
+				switch (__isa__())
+				{
+					// each tier hands over its leftover to the narrower one
+					case isa::AVX512:
+					{
+						out += avx512::__difcp__(ptr, tail);
+						[[fallthrough]];
+					}
+					case isa::AVX2:
+					{
+						out += avx2::__difcp__(ptr, tail);
+						[[fallthrough]];
+					}
+					case isa::SSE42:
+					{
+						out += sse42::__difcp__(ptr, tail);
+						[[fallthrough]];
+					}
+					case isa::SCALAR:
+					{
+						break;
+					}
+				}
+
+				if (tail <= ptr) return out;
+				#endif//X86_64
+			}
+		}
+		return out;
+	}
+
+	if constexpr (!Codec::is_variable)
+	{
+		// one code unit per code point
+		return tail - head;
+	}
+}
+
+template <typename Codec> constexpr auto detail::__check__(const typename Codec::T* head, const typename Codec::T* tail) noexcept -> std::expected<void, error>
+{
+	typedef typename Codec::T T;
+
+	const T* ptr {head};
+
+	if !consteval
+	{
+		#if X86_64
+		// validate as much as the vector kernels allow
+		switch (__isa__())
+		{
+			// each tier hands over its leftover to the narrower one
+			case isa::AVX512:
+			{
+				avx512::__check__(ptr, tail);
+				[[fallthrough]];
+			}
+			case isa::AVX2:
+			{
+				avx2::__check__(ptr, tail);
+				[[fallthrough]];
+			}
+			case isa::SSE42:
+			{
+				sse42::__check__(ptr, tail);
+				[[fallthrough]];
+			}
+			case isa::SCALAR:
+			{
+				break;
+			}
+		}
+		#endif//X86_64
+	}
+
+	const auto fail {[&](error::kind_t kind) noexcept -> std::expected<void, error>
+	{
+		return std::unexpected<error>({static_cast<size_t>(ptr - head), kind});
+	}};
+
+	while (ptr < tail)
+	{
+		const auto unit {static_cast<uint32_t>(*ptr)};
+
+		if constexpr (std::is_same_v<Codec, codec<"ASCII">>)
+		{
+			if (0x7F < unit) return fail(error::TOO_LARGE);
+
+			ptr += 1;
+		}
+		if constexpr (std::is_same_v<Codec, codec<"UTF-8">>)
+		{
+			if (unit < 0x80) { ptr += 1; continue; }
+
+			if (unit < 0xC0) return fail(error::TOO_LONG);
+			if (unit < 0xC2) return fail(error::OVERLONG);
+			if (0xF4 < unit) return fail(error::TOO_LARGE);
+
+			const auto step {Codec::next(ptr)};
+
+			for (int8_t i {1}; i < step; ++i)
+			{
+				if (tail - ptr <= i || (ptr[i] & 0xC0) != 0x80) return fail(error::TOO_SHORT);
+
+				if (i == 1)
+				{
+					// the 2nd byte is narrower right after these leads
+					if (unit == 0xE0 && ptr[1] < 0xA0) return fail(error::OVERLONG);
+					if (unit == 0xED && ptr[1] > 0x9F) return fail(error::SURROGATE);
+					if (unit == 0xF0 && ptr[1] < 0x90) return fail(error::OVERLONG);
+					if (unit == 0xF4 && ptr[1] > 0x8F) return fail(error::TOO_LARGE);
+				}
+			}
+			ptr += step;
+		}
+		if constexpr (std::is_same_v<Codec, codec<"UTF-16">>)
+		{
+			if ((unit & 0xF800) != 0xD800) { ptr += 1; continue; }
+
+			if ((unit & 0xFC00) == 0xDC00) return fail(error::SURROGATE);
+			if (tail - ptr < 2) return fail(error::TOO_SHORT);
+			if ((ptr[1] & 0xFC00) != 0xDC00) return fail(error::SURROGATE);
+
+			ptr += 2;
+		}
+		if constexpr (std::is_same_v<Codec, codec<"UTF-32">>)
+		{
+			if (0x10FFFF < unit) return fail(error::TOO_LARGE);
+			if ((unit & 0xFFFFF800) == 0xD800) return fail(error::SURROGATE);
+
+			ptr += 1;
+		}
+	}
+	return {};
+}
+
+template <typename Codec,
+          typename Other> constexpr auto detail::__bound__(const typename Other::T* head, const typename Other::T* tail) noexcept -> size_t
+{
+	typedef typename Other::T U;
+
+	const auto units {static_cast<size_t>(tail - head)};
+
+	if constexpr (std::is_same_v<Codec, Other>)
+	{
+		// 1:1
+		return units;
+	}
+
+	if constexpr (!std::is_same_v<Codec, Other> && !Codec::is_variable)
+	{
+		// one code unit per code point
+		return __difcp__<Other>(head, tail);
+	}
+
+	if constexpr (!std::is_same_v<Codec, Other> && Codec::is_variable)
+	{
+		// short ones get their exact size, so that they still fit in SSO
+		if (units <= 32)
+		{
+			size_t out {0};
+
+			for (const U* ptr {head}; ptr < tail; )
+			{
+				char32_t code;
+
+				const auto U_step {Other::next(ptr)};
+				Other::decode(ptr, code, U_step);
+				const auto T_step {Codec::size(code)};
+
+				ptr += U_step;
+				out += T_step;
+			}
+			return out;
+		}
+
+		//┌────────┬───────┬────────┬────────┬────────┐
+		//│ to\from │ ASCII │ UTF-8  │ UTF-16 │ UTF-32 │
+		//├────────┼───────┼────────┼────────┼────────┤
+		//│ UTF-8  │  4*   │   -    │   3    │   4    │
+		//│ UTF-16 │  2*   │   1    │   -    │   2    │
+		//└────────┴───────┴────────┴────────┴────────┘
+		//  * a byte past 0x7F decodes to anything
+
+		// the most code units a code unit may turn into
+		constexpr const size_t ratio
+		{
+			std::is_same_v<Codec, codec<"UTF-8">>
+			?
+			(std::is_same_v<Other, codec<"UTF-16">> ? 3 : 4)
+			:
+			(std::is_same_v<Other, codec<"UTF-8">> ? 1 : 2)
+		};
+
+		// +1 for a sequence cut by the tail, which still decodes as a whole
+		return units * ratio + 1;
+	}
+}
+
+template <typename Codec,
+          typename Other> constexpr auto detail::__fcopy__(const typename Other::T* head, const typename Other::T* tail,
+                                                                                          /*&*/ typename Codec::T* dest) noexcept -> size_t
+{
+	typedef typename Codec::T T;
+	typedef typename Other::T U;
+
+	if constexpr (std::is_same_v<Codec, Other>)
+	{
+		std::ranges::copy/*forward*/
+		(
+			head,
+			tail,
+			dest
+		);
+
+		return __difcu__<Codec>(head, tail);
+	}
+
+	if constexpr (!std::is_same_v<Codec, Other>)
+	{
+		T* out {dest};
+
+		// for (const U* ptr {head}; ptr < tail; )
+		// {
+		// 	char32_t code;
+
+		// 	const auto U_step {Other::next(ptr)};
+		// 	Other::decode(ptr, code, U_step);
+		// 	const auto T_step {Codec::size(code)};
+
+		// 	ptr += U_step;
+		// 	out += T_step;
+		// }
+
+		for (const U* ptr {head}; ptr < tail; )
+		{
+			// transcode as much as the vector kernels allow
+			__vcopy__<Codec, Other>(ptr, tail, out);
+
+			if (tail <= ptr) break;
+
+			char32_t code;
+
+			const auto U_step {Other::next(ptr)};
+			Other::decode(ptr, code, U_step);
+			const auto T_step {Codec::size(code)};
+			Codec::encode(code, out, T_step);
+
+			ptr += U_step;
+			out += T_step;
+		}
+
+		return __difcu__<Codec>(dest, out);
+	}
+}
+
+inline auto detail::__ostream__(std::ostream& os, const char16_t* head, const char16_t* tail) noexcept -> void
+{
+	// up to 3 bytes per code unit
+	char8_t buffer[3 * 256];
+
+	for (const char16_t* ptr {head}; ptr < tail; )
+	{
+		const char16_t* end {ptr + std::min<ptrdiff_t>(256, tail - ptr)};
+
+		if (end < tail)
+		{
+			size_t run {0};
+
+			// a run of high surrogates pairs up from its start; keep an odd one out for the next chunk
+			for (const char16_t* it {end}; ptr < it && (it[-1] >> 0xA) == 0x36; --it, ++run) {}
+
+			end -= run % 2;
+		}
+
+		const auto size {__fcopy__<codec<"UTF-8">, codec<"UTF-16">>(ptr, end, buffer)};
+
+		os.write(reinterpret_cast<const char*>(buffer), static_cast<std::streamsize>(size));
+
+		ptr = end;
+	}
+}
+
+template <typename Codec,
+          typename Other> constexpr auto detail::__rcopy__(const typename Other::T* head, const typename Other::T* tail,
+                                                                                          /*&*/ typename Codec::T* dest) noexcept -> size_t
+{
+	typedef typename Codec::T T;
+	typedef typename Other::T U;
+
+	if constexpr (std::is_same_v<Codec, Other>)
+	{
+		std::ranges::copy_backward
+		(
+			head,
+			tail,
+			dest + (tail - head) // one-past-the-end
+		);
+
+		return __difcu__<Codec>(head, tail);
+	}
+
+	if constexpr (!std::is_same_v<Codec, Other>)
+	{
+		// code units of different types never share storage; the order doesn't matter
+		return __fcopy__<Codec, Other>(head, tail, dest);
+	}
+}
+
+template <typename Codec,
+          typename Other> constexpr auto detail::__equal__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
+                                                           const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> bool
+{
+	typedef typename Codec::T T;
+	typedef typename Other::T U;
+
+	if constexpr (std::is_same_v<Codec, Other>)
+	{
+		if (lhs_0 == rhs_0
+		    &&
+		    lhs_N == rhs_N)
+		{
+			return true;
+		}
+
+		return __difcu__<Codec>(lhs_0, lhs_N)
+		       ==
+		       __difcu__<Other>(rhs_0, rhs_N)
+		       &&
+		       std::ranges::equal(lhs_0, lhs_N, rhs_0, rhs_N);
+	}
+
+	if constexpr (!std::is_same_v<Codec, Other>)
+	{
+		const T* lhs_ptr {lhs_0};
+		const U* rhs_ptr {rhs_0};
+
+		for (; lhs_ptr < lhs_N && rhs_ptr < rhs_N; )
+		{
+			char32_t T_code;
+			char32_t U_code;
+
+			const auto T_step {Codec::next(lhs_ptr)};
+			const auto U_step {Other::next(rhs_ptr)};
+
+			Codec::decode(lhs_ptr, T_code, T_step);
+			Other::decode(rhs_ptr, U_code, U_step);
+
+			if (T_code != U_code)
+			{
+				return false;
+			}
+
+			lhs_ptr += T_step;
+			rhs_ptr += U_step;
+		}
+
+		return lhs_ptr == lhs_N && rhs_ptr == rhs_N;
+	}
+}
+
+template <typename Codec,
+          typename Other> constexpr auto detail::__nqual__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
+                                                           const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> bool
+{
+	typedef typename Codec::T T;
+	typedef typename Other::T U;
+
+	if constexpr (std::is_same_v<Codec, Other>)
+	{
+		if (lhs_0 == rhs_0
+		    &&
+		    lhs_N == rhs_N)
+		{
+			return false;
+		}
+
+		return __difcu__<Codec>(lhs_0, lhs_N)
+		       !=
+		       __difcu__<Other>(rhs_0, rhs_N)
+		       ||
+		       !std::ranges::equal(lhs_0, lhs_N, rhs_0, rhs_N);
+	}
+
+	if constexpr (!std::is_same_v<Codec, Other>)
+	{
+		const T* lhs_ptr {lhs_0};
+		const U* rhs_ptr {rhs_0};
+
+		for (; lhs_ptr < lhs_N && rhs_ptr < rhs_N; )
+		{
+			char32_t T_code;
+			char32_t U_code;
+
+			const auto T_step {Codec::next(lhs_ptr)};
+			const auto U_step {Other::next(rhs_ptr)};
+
+			Codec::decode(lhs_ptr, T_code, T_step);
+			Other::decode(rhs_ptr, U_code, U_step);
+
+			if (T_code != U_code)
+			{
+				return true;
+			}
+
+			lhs_ptr += T_step;
+			rhs_ptr += U_step;
+		}
+
+		return lhs_ptr != lhs_N || rhs_ptr != rhs_N;
+	}
+}
+
+template <typename Codec,
+          typename Other> constexpr auto detail::__swith__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
+                                                           const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> bool
+{
+	typedef typename Codec::T T;
+	typedef typename Other::T U;
+
+	if constexpr (std::is_same_v<Codec, Other>)
+	{
+		if (lhs_0 == rhs_0
+		    &&
+		    lhs_N == rhs_N)
+		{
+			return true;
+		}
+
+		const auto lhs_len {__difcu__<Codec>(lhs_0, lhs_N)};
+		const auto rhs_len {__difcu__<Other>(rhs_0, rhs_N)};
+
+		return rhs_len == 0 // if rhs(delimeter) is an empty string (e.g. str.starts_with(""))
+		       ||
+		       (lhs_len >= rhs_len && std::ranges::equal(lhs_0, lhs_0 + rhs_len, rhs_0, rhs_N));
+	}
+
+	if constexpr (!std::is_same_v<Codec, Other>)
+	{
+		const T* lhs_ptr {lhs_0};
+		const U* rhs_ptr {rhs_0};
+
+		for (; lhs_ptr < lhs_N && rhs_ptr < rhs_N; )
+		{
+			char32_t T_code;
+			char32_t U_code;
+
+			const auto T_step {Codec::next(lhs_ptr)};
+			const auto U_step {Other::next(rhs_ptr)};
+
+			Codec::decode(lhs_ptr, T_code, T_step);
+			Other::decode(rhs_ptr, U_code, U_step);
+
+			if (T_code != U_code)
+			{
+				return false;
+			}
+
+			lhs_ptr += T_step;
+			rhs_ptr += U_step;
+		}
+
+		return rhs_ptr == rhs_N;
+	}
+}
+
+template <typename Codec,
+          typename Other> constexpr auto detail::__ewith__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
+                                                           const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> bool
+{
+	typedef typename Codec::T T;
+	typedef typename Other::T U;
+
+	if constexpr (std::is_same_v<Codec, Other>)
+	{
+		if (lhs_0 == rhs_0
+		    &&
+		    lhs_N == rhs_N)
+		{
+			return true;
+		}
+
+		const auto lhs_len {__difcu__<Codec>(lhs_0, lhs_N)};
+		const auto rhs_len {__difcu__<Other>(rhs_0, rhs_N)};
+
+		return rhs_len == 0 // if rhs(delimeter) is an empty string (e.g. str.ends_with(""))
+		       ||
+		       (lhs_len >= rhs_len && std::ranges::equal(lhs_N - rhs_len, lhs_N, rhs_0, rhs_N));
+	}
+
+	if constexpr (!std::is_same_v<Codec, Other>)
+	{
+		const T* lhs_ptr {lhs_N};
+		const U* rhs_ptr {rhs_N};
+
+		for (; lhs_0 < lhs_ptr && rhs_0 < rhs_ptr; )
+		{
+			char32_t T_code;
+			char32_t U_code;
+
+			const auto T_step {Codec::back(lhs_ptr)};
+			const auto U_step {Other::back(rhs_ptr)};
+
+			Codec::decode(lhs_ptr, T_code, T_step);
+			Other::decode(rhs_ptr, U_code, U_step);
+
+			if (T_code != U_code)
+			{
+				return false;
+			}
+
+			lhs_ptr += T_step;
+			rhs_ptr += U_step;
+		}
+
+		return rhs_ptr == rhs_0;
+	}
+}
+
+template <bool flip, typename It> constexpr auto detail::__suffix__(It head, It tail, size_t& period) noexcept -> ptrdiff_t
+{
+	const ptrdiff_t len {tail - head};
+
+	ptrdiff_t ms {-1};
+	ptrdiff_t j {+0};
+	ptrdiff_t k {+1};
+	ptrdiff_t p {+1};
+
+	while (j + k < len)
+	{
+		const auto a {head[j + k]};
+		const auto b {head[ms + k]};
+
+		if (flip ? b < a : a < b)
+		{
+			// the suffix at 'ms' still wins; the period spans it all
+			j += k; k = 1; p = j - ms;
+		}
+		else if (a == b)
+		{
+			// advance within, or across a full period
+			if (k != p) { ++k; } else { j += p; k = 1; }
+		}
+		else
+		{
+			// a greater suffix starts here
+			ms = j++; k = p = 1;
+		}
+	}
+
+	period = static_cast<size_t>(p);
+
+	return ms;
+}
+
+template <typename It> constexpr auto detail::__factor__(It head, It tail, ptrdiff_t& ell, size_t& per) noexcept -> bool
+{
+	size_t tmp;
+
+	// critical factorization; the longer of both maximal suffixes
+	const ptrdiff_t l_0 {__suffix__<false>(head, tail, per)};
+	const ptrdiff_t l_1 {__suffix__<true>(head, tail, tmp)};
+
+	ell = l_0 < l_1 ? l_1 : l_0; if (l_0 < l_1) { per = tmp; }
+
+	const ptrdiff_t m {tail - head};
+
+	// the left half repeats with period 'per'
+	const bool periodic
+	{
+		static_cast<ptrdiff_t>(per) + ell + 1 <= m
+		&&
+		std::equal(head, head + ell + 1, head + per)
+	};
+
+	if (!periodic)
+	{
+		// shift past the larger half on a full left mismatch
+		per = static_cast<size_t>(std::max(ell + 1, m - ell - 1) + 1);
+	}
+
+	return periodic;
+}
+
+template <typename It> constexpr auto detail::__twoway__(It lhs_0, It lhs_N,
+                                                         It rhs_0, It rhs_N, ptrdiff_t ell, size_t per, bool periodic) noexcept -> It
+{
+	const ptrdiff_t m {rhs_N - rhs_0};
+
+	ptrdiff_t i;
+	ptrdiff_t mem {-1};
+
+	for (It ptr {lhs_0}; m <= lhs_N - ptr;)
+	{
+		// right half, left to right
+		for (i = std::max(ell, mem) + 1; i < m && rhs_0[i] == ptr[i]; ++i) {}
+
+		if (i < m)
+		{
+			ptr += i - ell; mem = -1; continue;
+		}
+
+		// left half, right to left
+		for (i = ell; mem < i && rhs_0[i] == ptr[i]; --i) {}
+
+		if (mem < i)
+		{
+			ptr += per; mem = periodic ? m - static_cast<ptrdiff_t>(per) - 1 : -1; continue;
+		}
+
+		return ptr;
+	}
+	return It {};
+}
+
+template <typename T> constexpr auto detail::__horspool__(const T*& head, const T* tail, const T* rhs, size_t len, const size_t (&skip)[256], ptrdiff_t& credit) noexcept -> const T*
+{
+	typedef std::make_unsigned_t<T> U;
+
+	const T* ptr {head};
+
+	for (; 0 <= credit && len <= static_cast<size_t>(tail - ptr); )
+	{
+		if (ptr[len - 1] == rhs[len - 1])
+		{
+			const T* end {std::mismatch(rhs, rhs + len - 1, ptr).first};
+
+			if (end == rhs + len - 1) { head = ptr; return ptr; }
+
+			credit -= end - rhs;
+		}
+
+		const size_t step {skip[static_cast<U>(ptr[len - 1]) & 0xFF]};
+
+		ptr += step; credit += static_cast<ptrdiff_t>(step);
+	}
+	head = ptr; return nullptr;
+}
+
+template <typename T> constexpr auto detail::__filter__(const T*& head, const T* tail, const T* rhs, size_t len, ptrdiff_t& credit) noexcept -> const T*
+{
+	if !consteval
+	{
+		#if X86_64
+		if (2 <= len)
+		{
+			// filter by the 1st and last unit, then verify
+			switch (__isa__())
+			{
+				// each tier hands over its leftover to the narrower one
+				case isa::AVX512:
+				{
+					if (const T* hit {avx512::__find__(head, tail, rhs, len, credit)}) return hit;
+					[[fallthrough]];
+				}
+				case isa::AVX2:
+				{
+					if (const T* hit {avx2::__find__(head, tail, rhs, len, credit)}) return hit;
+					[[fallthrough]];
+				}
+				case isa::SSE42:
+				{
+					if (const T* hit {sse42::__find__(head, tail, rhs, len, credit)}) return hit;
+					[[fallthrough]];
+				}
+				case isa::SCALAR:
+				{
+					break;
+				}
+			}
+		}
+		#endif//X86_64
+	}
+	return nullptr;
+}
+
+template <typename Codec,
+          typename Other> constexpr auto detail::__needle__(const typename Other::T* rhs_0, const typename Other::T* rhs_N, const auto& fun) noexcept -> void
+{
+	typedef typename Codec::T T;
+	typedef typename Other::T U;
+
+	// transcoded needles up to this many units stay on the stack
+	constexpr const size_t SBO {256};
+
+	// encodings are canonical; a needle transcoded once matches exactly where its code points would
+	const auto rhs_len {__bound__<Codec, Other>(rhs_0, rhs_N)};
+
+	T sbo_rhs[SBO];
+	std::vector<T> heap_rhs;
+
+	// allocation-free for short needles
+	T* rhs {rhs_len <= SBO ? sbo_rhs : (heap_rhs.resize(rhs_len), heap_rhs.data())};
+	T* out {rhs};
+
+	for (const U* ptr {rhs_0}; ptr < rhs_N; )
+	{
+		char32_t code;
+		char32_t back;
+
+		const auto U_step {Other::next(ptr)};
+		Other::decode(ptr, code, U_step);
+		const auto T_step {Codec::size(code)};
+		Codec::encode(code, out, T_step);
+		Codec::decode(out, back, T_step);
+
+		// e.g. U+00E9 has no place in ASCII; nothing in the haystack decodes to it
+		if (code != back) { return; }
+
+		ptr += U_step;
+		out += T_step;
+	}
+
+	fun(static_cast<const T*>(rhs), static_cast<const T*>(out));
+}
+
+template <typename Codec,
+          typename Other> constexpr auto detail::__scan__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
+                                                          const typename Other::T* rhs_0, const typename Other::T* rhs_N,
+                                                                                          const auto& fun /* lambda E */) noexcept -> void
+{
+	typedef typename Codec::T T;
+
+	// 'fun' may return false to stop the scan early
+	const auto emit {[&](const T* head, const T* tail) -> bool
+	{
+		if constexpr (std::is_void_v<decltype(fun(head, tail))>)
+		{
+			fun(head, tail); return true;
+		}
+		if constexpr (!std::is_void_v<decltype(fun(head, tail))>)
+		{
+			return fun(head, tail);
+		}
+	}};
+
+	if constexpr (std::is_same_v<Codec, Other>)
+	{
+		const auto lhs_len {__difcu__<Codec>(lhs_0, lhs_N)};
+		const auto rhs_len {__difcu__<Other>(rhs_0, rhs_N)};
+
+		if (0 < lhs_len && 0 < rhs_len)
+		{
+			if (lhs_len == rhs_len)
+			{
+				if (lhs_0 == rhs_0
+				    &&
+				    lhs_N == rhs_N)
+				{
+					emit(lhs_0, lhs_N);
+				}
+				else if (__equal__<Codec, Other>(lhs_0, lhs_N,
+				                                 rhs_0, rhs_N))
+				{
+					emit(lhs_0, lhs_N);
+				}
+			}
+			else if (lhs_len < rhs_len)
+			{
+				// nothing to do...
+			}
+			else if (lhs_len > rhs_len)
+			{
+				ptrdiff_t ell;
+				size_t per;
+
+				const bool periodic {__factor__(rhs_0, rhs_N, ell, per)};
+
+				// false candidates allowed before falling back to Two-Way
+				ptrdiff_t credit {16};
+
+				for (const T* ptr {lhs_0}; ; ptr += rhs_len)
+				{
+					const T* hit {__filter__<T>(ptr, lhs_N, rhs_0, rhs_len, credit)};
+
+					if (hit == nullptr)
+					{
+						// Two-Way; the leftover of the vector kernels
+						hit = __twoway__(ptr, lhs_N, rhs_0, rhs_N, ell, per, periodic);
+					}
+
+					// flush ptr
+					if (hit == nullptr || !emit(hit, hit + rhs_len)) { return; }
+
+					ptr = hit; // non-overlapping
+				}
+			}
+		}
+	}
+	
+	if constexpr (!std::is_same_v<Codec, Other>)
+	{
+		__needle__<Codec, Other>(rhs_0, rhs_N,
+			// in the haystack's codec
+			[&](const T* head, const T* tail)
+			{
+				__scan__<Codec, Codec>(lhs_0, lhs_N, head, tail, fun);
+			}
+		);
+	}
+}
+
+template <typename Codec,
+          typename Other> constexpr auto detail::__rfind__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
+                                                           const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> const typename Codec::T*
+{
+	typedef typename Codec::T T;
+
+	if constexpr (std::is_same_v<Codec, Other>)
+	{
+		typedef std::reverse_iterator<const T*> It;
+
+		if (rhs_0 == rhs_N) { return nullptr; }
+
+		ptrdiff_t ell;
+		size_t per;
+
+		// Two-Way, mirrored; the needle and the haystack both read from their tail
+		const bool periodic {__factor__(It {rhs_N}, It {rhs_0}, ell, per)};
+
+		const It hit {__twoway__(It {lhs_N}, It {lhs_0}, It {rhs_N}, It {rhs_0}, ell, per, periodic)};
+
+		// the mirrored match ends where the real one starts
+		return hit == It {} ? nullptr : (hit + (rhs_N - rhs_0)).base();
+	}
+
+	if constexpr (!std::is_same_v<Codec, Other>)
+	{
+		const T* out {nullptr};
+
+		__needle__<Codec, Other>(rhs_0, rhs_N,
+			// in the haystack's codec
+			[&](const T* head, const T* tail)
+			{
+				out = __rfind__<Codec, Codec>(lhs_0, lhs_N, head, tail);
+			}
+		);
+
+		return out;
+	}
+}
+
+template <typename Codec,
+          typename Other> constexpr auto detail::__nth__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
+                                                         const typename Other::T* rhs_0, const typename Other::T* rhs_N, size_t nth) noexcept -> const typename Codec::T*
+{
+	typedef typename Codec::T T;
+
+	const T* out {nullptr};
+
+	__scan__<Codec, Other>(lhs_0, lhs_N,
+	                       rhs_0, rhs_N,
+		// on every distinct match found, up to the nth
+		[&](const T* head, const T*)
+		{
+			if (nth == 0) { out = head; return false; } --nth; return true;
+		}
+	);
+
+	return out;
+}
+
+template <typename Codec,
+          typename Other> constexpr auto detail::__every__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
+                                                           const typename Other::T* rhs_0, const typename Other::T* rhs_N, std::vector<offset>& out, index mode) noexcept -> size_t
+{
+	typedef typename Codec::T T;
+
+	const auto size {out.size()};
+
+	const T* last {lhs_0};
+	size_t code {0};
+
+	__scan__<Codec, Other>(lhs_0, lhs_N,
+	                       rhs_0, rhs_N,
+		// on every distinct match found
+		[&](const T* head, const T*)
+		{
+			if (mode == index::CODE)
+			{
+				code += __difcp__<Codec>(last, head); last = head;
+
+				out.push_back({static_cast<size_t>(head - lhs_0), code});
+			}
+			else
+			{
+				out.push_back({static_cast<size_t>(head - lhs_0), std::nullopt});
+			}
+		}
+	);
+
+	return out.size() - size;
+}
+
+template <typename Codec> constexpr auto detail::__offset__(const typename Codec::T* head, const typename Codec::T* hit, index mode) noexcept -> std::optional<offset>
+{
+	if (hit == nullptr)
+	{
+		return std::nullopt;
+	}
+
+	if (mode == index::CODE)
+	{
+		return offset {static_cast<size_t>(hit - head), __difcp__<Codec>(head, hit)};
+	}
+	else
+	{
+		return offset {static_cast<size_t>(hit - head), std::nullopt};
+	}
+}
+
+template <typename Codec,
+          typename Other> constexpr auto detail::__count__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
+	                                                       const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> size_t
+{
+	typedef typename Codec::T T;
+
+	size_t out {0};
+
+	__scan__<Codec, Other>(lhs_0, lhs_N,
+	                       rhs_0, rhs_N,
+		// on every distinct match found
+		[&](const T*, const T*)
+		{
+			++out;
+		}
+	);
+
+	return out;
+}
+
+template <typename Codec,
+          typename Other> constexpr auto detail::__exist__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
+	                                                       const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> bool
+{
+	typedef typename Codec::T T;
+
+	bool out {false};
+
+	__scan__<Codec, Other>(lhs_0, lhs_N,
+	                       rhs_0, rhs_N,
+		// on the 1st match found
+		[&](const T*, const T*)
+		{
+			out = true; return false;
+		}
+	);
+
+	return out;
+}
+
+template <typename Codec,
+          typename Other> constexpr auto detail::__split__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
+	                                                       const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> std::vector<txt<Codec>>
+{
+	typedef typename Codec::T T;
+	typedef typename Other::T U;
+
+	std::vector<txt<Codec>> out;
+
+	const T* last {lhs_0};
+
+	__scan__<Codec, Other>(lhs_0, lhs_N,
+	                       rhs_0, rhs_N,
+		// on every distinct match found
+		[&](const T* head, const T* tail)
+		{
+			if (head != last)
+			{
+				out.emplace_back(last, head);
+
+				last = tail; // update anchor
+			}
+		}
+	);
+
+	if (last != lhs_0 && last < lhs_N)
+	{
+		out.emplace_back(last, lhs_N);
+	}
+
+	return out;
+}
+
+template <typename Codec,
+          typename Other> constexpr auto detail::__match__(const typename Codec::T* lhs_0, const typename Codec::T* lhs_N,
+	                                                       const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> std::vector<txt<Codec>>
+{
+	typedef typename Codec::T T;
+	typedef typename Other::T U;
+
+	std::vector<txt<Codec>> out;
+
+	__scan__<Codec, Other>(lhs_0, lhs_N,
+	                       rhs_0, rhs_N,
+		// on every distinct match found
+		[&](const T* head, const T* tail)
+		{
+			out.emplace_back(head, tail);
+		}
+	);
+
+	// if (last != lhs_0 && last < lhs_N)
+	// {
+	// 	out.emplace_back(last, lhs_N);
+	// }
+
+	return out;
+}
+
+template <typename Codec> constexpr auto detail::__substr__(const typename Codec::T* head, const typename Codec::T* tail, clamp  start, clamp  until) noexcept -> txt<Codec>
+{
+	typedef typename Codec::T T;
+
+	// e.g. str.substr(N - 1, N - 0);
+
+	assert(until < start);
+
+	const T* foo {tail};
+	
+	for (size_t i {  0  }; i < until && head < foo; ++i, foo += Codec::back(foo)) {}
+
+	const T* bar {foo};
+
+	for (size_t i {until}; i < start && head < bar; ++i, bar += Codec::back(bar)) {}
+
+	assert(head <= foo && foo <= tail);
+	assert(head <= bar && bar <= tail);
+
+	return {bar, foo};
+}
+
+template <typename Codec> constexpr auto detail::__substr__(const typename Codec::T* head, const typename Codec::T* tail, [[maybe_unused]] clamp  start, [[maybe_unused]] range  until) noexcept -> txt<Codec>
+{
+	typedef typename Codec::T T;
+
+	// e.g. str.substr(N - 1, N);
+
+	const T* foo {tail};
+
+	for (size_t i {  0  }; i < start && head < foo; ++i, foo += Codec::back(foo)) {}
+
+	const T* bar {tail};
+
+	assert(head <= foo && foo <= tail);
+	assert(head <= bar && bar <= tail);
+
+	return {foo, bar};
+}
+
+template <typename Codec> constexpr auto detail::__substr__(const typename Codec::T* head, const typename Codec::T* tail, [[maybe_unused]] size_t start, [[maybe_unused]] clamp  until) noexcept -> txt<Codec>
+{
+	typedef typename Codec::T T;
+
+	// e.g. str.substr(0, N - 1);
+
+	const T* foo {head};
+
+	for (size_t i {  0  }; i < start && foo < tail; ++i, foo += Codec::next(foo)) {}
+
+	const T* bar {tail};
+
+	for (size_t i {  0  }; i < until && head < bar; ++i, bar += Codec::back(bar)) {}
+
+	assert(head <= foo && foo <= tail);
+	assert(head <= bar && bar <= tail);
+
+	return {foo, bar};
+}
+
+template <typename Codec> constexpr auto detail::__substr__(const typename Codec::T* head, const typename Codec::T* tail, [[maybe_unused]] size_t start, [[maybe_unused]] range  until) noexcept -> txt<Codec>
+{
+	typedef typename Codec::T T;
+
+	// e.g. str.substr(0, N);
+
+	const T* foo {head};
+
+	for (size_t i {  0  }; i < start && foo < tail; ++i, foo += Codec::next(foo)) {}
+
+	const T* bar {tail};
+
+	assert(head <= foo && foo <= tail);
+	assert(head <= bar && bar <= tail);
+
+	return {foo, bar};
+}
+
+template <typename Codec> constexpr auto detail::__substr__(const typename Codec::T* head, const typename Codec::T* tail, [[maybe_unused]] size_t start, [[maybe_unused]] size_t until) noexcept -> txt<Codec>
+{
+	typedef typename Codec::T T;
+
+	// e.g. str.substr(6, 9);
+
+	assert(start < until);
+
+	const T* foo {head};
+
+	for (size_t i {  0  }; i < start && foo < tail; ++i, foo += Codec::next(foo)) {}
+
+	const T* bar {foo};
+
+	for (size_t i {start}; i < until && bar < tail; ++i, bar += Codec::next(bar)) {}
+
+	assert(head <= foo && foo <= tail);
+	assert(head <= bar && bar <= tail);
+
+	return {foo, bar};
+}
+
+#pragma endregion CRTP::detail
+#pragma region SSO23
+
+template <typename Codec, typename Alloc> constexpr str<Codec, Alloc>::buffer::operator const typename str<Codec, Alloc>::T*() const noexcept
+{
+	return this->head;
+}
+
+template <typename Codec, typename Alloc> constexpr str<Codec, Alloc>::buffer::operator /*&*/ typename str<Codec, Alloc>::T*() /*&*/ noexcept
+{
+	return this->head;
+}
+
+template <typename Codec, typename Alloc> constexpr str<Codec, Alloc>::storage::storage() noexcept
+{
+	this->__union__.bytes[RMB] = MAX << SFT;
+	// std::construct_at(&this->__union__.large);
+}
+
+template <typename Codec, typename Alloc> constexpr str<Codec, Alloc>::storage::~storage() noexcept
+{
+	if (this->mode() == LARGE)
+	{
+		if !consteval
+		{
+			if constexpr (SLOT)
+			{
+				meta* side;
+
+				std::memcpy(&side, (*this).__union__.large.head - __slot__(), sizeof(side));
+
+				__detach__((*this), side);
+			}
+		}
+
+		allocator::deallocate
+		(
+			(*this),
+			(*this).__union__.large.head - __slot__(),
+			(*this).__union__.large.last
+			-
+			(*this).__union__.large.head + __slot__()
+		);
+	}
+}
+
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::storage::mode() const noexcept -> mode_t
+{
+	return static_cast<mode_t>(this->__union__.bytes[RMB] & MSK);
+}
+
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::storage::mode() /*&*/ noexcept -> mode_t
+{
+	return static_cast<mode_t>(this->__union__.bytes[RMB] & MSK);
+}
+
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::__head__() const noexcept -> const T*
+{
+	return this->store.mode() == SMALL
+	       ?
+	       this->store.__union__.small // ✨ roeses are red, violets are blue
+	       :
+	       this->store.__union__.large; // ✨ roeses are red, violets are blue
+}
+
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::__head__() /*&*/ noexcept -> /*&*/ T*
+{
+	return this->store.mode() == SMALL
+	       ?
+	       this->store.__union__.small // ✨ roeses are red, violets are blue
+	       :
+	       this->store.__union__.large; // ✨ roeses are red, violets are blue
+}
+
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::__tail__() const noexcept -> const T*
+{
+	return this->store.mode() == SMALL
+	       ?
+	       &this->store.__union__.small[MAX - (this->store.__union__.bytes[RMB] >> SFT)]
+	       :
+	       &this->store.__union__.large[this->store.__union__.large.size /* read-as-is */];
+}
+
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::__tail__() /*&*/ noexcept -> /*&*/ T*
+{
+	return this->store.mode() == SMALL
+	       ?
+	       &this->store.__union__.small[MAX - (this->store.__union__.bytes[RMB] >> SFT)]
+	       :
+	       &this->store.__union__.large[this->store.__union__.large.size /* read-as-is */];
+}
+
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::__last__() const noexcept -> const T*
+{
+	return this->store.mode() == SMALL
+	       ?
+	       &this->store.__union__.small[MAX] // ✨ roeses are red, violets are blue
+	       :
+	       this->store.__union__.large.last; // ✨ roeses are red, violets are blue
+}
+
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::__last__() /*&*/ noexcept -> /*&*/ T*
+{
+	return this->store.mode() == SMALL
+	       ?
+	       &this->store.__union__.small[MAX] // ✨ roeses are red, violets are blue
+	       :
+	       this->store.__union__.large.last; // ✨ roeses are red, violets are blue
+}
+
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::capacity(/* getter */) const noexcept -> size_t
+{
+	return this->store.mode() == SMALL
+	       ?
+	       MAX // or calculate the ptrdiff_t just as large mode as shown down below
+	       :
+	       this->store.__union__.large.last - this->store.__union__.large.head - 1;
+}
+
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::capacity(size_t value) /*&*/ noexcept -> void
+{
+	if (this->capacity() < value)
+	{
+		T* head {allocator::allocate(this->store, value + 1 + __slot__()) + __slot__()};
+		T* tail {/* <one-past-the-end!> */(head + value + 1)};
+
+		const auto size {this->size()};
+
+		detail::__fcopy__<Codec, Codec>
+		(
+			this->__head__(),
+			this->__tail__(),
+			head // dest
+		);
+
+		// offsets are relative to the head; the side index moves along as is
+		meta* side {this->__meta__()};
+
+		if (this->store.mode() == LARGE)
+		{
+			allocator::deallocate
+			(
+				this->store,
+				this->store.__union__.large.head - __slot__(),
+				this->store.__union__.large.last
+				-
+				this->store.__union__.large.head + __slot__()
+			);
+		}
+
+		std::construct_at(&this->store.__union__.large);
+		{
+			this->store.__union__.large.head = head;
+			this->store.__union__.large.last = tail;
+			this->store.__union__.large.size = size;
+			this->store.__union__.large.meta = LARGE;
+		}
+
+		this->__meta__(side);
+	}
+}
+
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::reserve(size_t value) /*&*/ noexcept -> void
+{
+	if (const auto cap {this->capacity()}; cap < value)
+	{
+		using factor = growth<Alloc>;
+
+		// a run of appends then costs O(1) per code unit, amortized
+		this->capacity(std::max(value, cap <= SIZE_MAX / factor::num ? cap * factor::num / factor::den : value));
+	}
+}
+
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::shrink_to_fit(/* exact */) /*&*/ noexcept -> void
+{
+	if (this->store.mode() == LARGE && (this->size() <= MAX || this->size() < this->capacity()))
+	{
+		// small enough stays small; the rest is allocated exactly
+		str out;
+
+		out.capacity(this->size());
+
+		detail::__fcopy__<Codec, Codec>
+		(
+			this->__head__(),
+			this->__tail__(),
+			out.__head__()
+		);
+
+		out.__size__(this->size());
+
+		// same content, same offsets; the side index moves along as is
+		if (out.store.mode() == LARGE)
+		{
+			out.__meta__(this->__meta__());
+			this->__meta__(nullptr);
+		}
+
+		*this = std::move(out);
+	}
+}
+
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::__trim__() noexcept -> void
+{
+	using factor = growth<Alloc>;
+
+	const auto size {this->size()};
+
+	// i.e. 3x for UTF-16 to UTF-8, a slack that would otherwise stay for good
+	if (this->store.mode() == LARGE && std::max(size * 2, size / factor::den * factor::num) < this->capacity())
+	{
+		this->shrink_to_fit();
+	}
+}
+
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::build_index(/* eager */) /*&*/ noexcept -> void
+{
+	this->__index__(SIZE_MAX);
+}
+
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::__size__(size_t value) noexcept -> void
+{
+	switch (this->store.mode())
+	{
+		case SMALL:
+		{
+			// never past SSO; capacity() would have moved it to the heap
+			if (MAX < value) { assert(false); std::unreachable(); }
+
+			const auto slot {(MAX - value) << SFT};
+
+			//┌────────────┐    ┌───────[LE]───────┐
+			//│ 0b0XXXXXXX │ -> │ no need for skip │
+			//└────────────┘    └──────────────────┘
+
+			//┌────────────┐    ┌───────[BE]───────┐
+			//│ 0bXXXXXXX0 │ -> │ skip right 1 bit │
+			//└────────────┘    └──────────────────┘
+
+			this->store.__union__.bytes[RMB] = slot;
+			this->store.__union__.small[value] = '\0';
+			break;
+		}
+		case LARGE:
+		{
+			this->store.__union__.large.size = value;
+			this->store.__union__.large[value] = '\0';
+			this->__stale__(value);
+			break;
+		}
+	}
+}
+
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::__slot__() noexcept -> size_t
+{
+	if consteval
+	{
+		// no type punning at compile time
+		return 0;
+	}
+	else
+	{
+		return SLOT ? (sizeof(meta*) + sizeof(T) - 1) / sizeof(T) : 0;
+	}
+}
+
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::__meta__() const noexcept -> meta*
+{
+	meta* out {nullptr};
+
+	if !consteval
+	{
+		if (SLOT && this->store.mode() == LARGE)
+		{
+			// the slot may be misaligned for a ptr
+			std::memcpy(&out, this->store.__union__.large.head - __slot__(), sizeof(out));
+		}
+	}
+	return out;
+}
+
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::__meta__(meta* value) /*&*/ noexcept -> void
+{
+	if !consteval
+	{
+		if (SLOT && this->store.mode() == LARGE)
+		{
+			// the slot may be misaligned for a ptr
+			std::memcpy(this->store.__union__.large.head - __slot__(), &value, sizeof(value));
+		}
+	}
+}
+
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::__attach__() /*&*/ noexcept -> meta*
+{
+	meta* side {this->__meta__()};
+
+	if (side == nullptr)
+	{
+		typename meta_allocator::allocator_type rebound {this->store};
+
+		side = meta_allocator::allocate(rebound, 1);
+		meta_allocator::construct(rebound, side, typename meta::crumbs_t {this->store});
+
+		this->__meta__(side);
+	}
+	return side;
+}
+
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::__detach__(Alloc& alloc, meta* side) noexcept -> void
+{
+	if (side != nullptr)
+	{
+		typename meta_allocator::allocator_type rebound {alloc};
+
+		meta_allocator::destroy(rebound, side);
+		meta_allocator::deallocate(rebound, side, 1);
+	}
+}
+
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::__stale__(size_t from) noexcept -> void
+{
+	if (meta* side {this->__meta__()})
+	{
+		auto& crumbs {side->crumbs};
+
+		while (1 < crumbs.size() && from < crumbs.back()) { crumbs.pop_back(); }
+
+		// whoever changed it knows better
+		side->length.reset();
+	}
+}
+
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::__shift__(size_t from, ptrdiff_t delta) noexcept -> void
+{
+	if (meta* side {this->__meta__()})
+	{
+		auto& crumbs {side->crumbs};
+
+		// sorted; the 1st one past 'from' onwards
+		for (auto it {std::upper_bound(crumbs.begin(), crumbs.end(), from)}; it != crumbs.end(); ++it)
+		{
+			*it += delta;
+		}
+	}
+}
+
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::__length__() const noexcept -> std::optional<size_t>
+{
+	if constexpr (COUNT)
+	{
+		if (meta* side {this->__meta__()})
+		{
+			return side->length;
+		}
+	}
+	return std::nullopt;
+}
+
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::__length__(std::optional<size_t> value) /*&*/ noexcept -> void
+{
+	if constexpr (COUNT)
+	{
+		meta* side {this->__meta__()};
+
+		// a short scan is cheaper than the bookkeeping; implies large mode
+		if (value.has_value() && STEP < this->size())
+		{
+			if !consteval
+			{
+				this->__attach__()->length = value;
+			}
+		}
+		else if (side != nullptr)
+		{
+			side->length.reset();
+		}
+	}
+}
+
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::__recount__(std::optional<size_t> prev, size_t from) /*&*/ noexcept -> void
+{
+	if constexpr (COUNT)
+	{
+		if !consteval
+		{
+			if (STEP < this->size())
+			{
+				const T* head {this->__head__()};
+				const T* tail {this->__tail__()};
+
+				// nothing in front to count
+				if (from == 0) { prev = 0; }
+
+				// only what is new, unless what was there is unknown
+				if (prev.has_value())
+				{
+					this->__length__(*prev + detail::__difcp__<Codec>(head + from, tail));
+				}
+				else
+				{
+					this->__length__(/*&&&&*/ detail::__difcp__<Codec>(head /*&&*/, tail));
+				}
+			}
+		}
+	}
+}
+
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::__seek__(size_t nth) const noexcept -> const T*
+{
+	const T* head {this->__head__()};
+	const T* tail {this->__tail__()};
+
+	if constexpr (!Codec::is_variable
+	              &&
+	              !Codec::is_stateful)
+	{
+		return head + std::min(nth, this->size());
+	}
+
+	const T* ptr {head};
+
+	// read only; jumps by whatever is indexed so far, if anything
+	if (const meta* side {this->__meta__()}; side != nullptr && !side->crumbs.empty())
+	{
+		const auto& crumbs {side->crumbs};
+
+		const auto j {std::min(nth / STEP, crumbs.size() - 1)};
+
+		ptr += crumbs[j];
+		nth -= j * STEP;
+	}
+
+	for (; 0 < nth && ptr < tail; --nth) { ptr += Codec::next(ptr); }
+
+	return ptr;
+}
+
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::__seek__(size_t nth) /*&*/ noexcept -> const T*
+{
+	this->__index__(nth);
+
+	return std::as_const(*this).__seek__(nth);
+}
+
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::__index__(size_t nth) noexcept -> void
+{
+	if constexpr (Codec::is_variable
+	              ||
+	              Codec::is_stateful)
+	{
+		if !consteval
+		{
+			// a short walk is cheaper than the index
+			if (this->store.mode() == LARGE && STEP < this->size())
+			{
+				auto& crumbs {this->__attach__()->crumbs};
+
+				if (crumbs.empty()) { crumbs.push_back(0); }
+
+				// extend the breadcrumbs lazily, only as far as needed
+				if (crumbs.size() <= nth / STEP)
+				{
+					const T* head {this->__head__()};
+					const T* tail {this->__tail__()};
+
+					const T* end {head + crumbs.back()};
+
+					for (size_t i {0}; end < tail && crumbs.size() <= nth / STEP; )
+					{
+						end += Codec::next(end);
+
+						if (++i == STEP)
+						{
+							crumbs.push_back(static_cast<size_t>(end - head)); i = 0;
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+#pragma endregion SSO23
+#pragma region str
+
+template <typename Codec, typename Alloc> constexpr str<Codec, Alloc>::operator const T*() const noexcept
+{
+	return this->__head__();
+}
+
+template <typename Codec, typename Alloc> constexpr str<Codec, Alloc>::operator /*&*/ T*() /*&*/ noexcept
+{
+	return this->__head__();
+}
+
+template <typename Codec, typename Alloc> constexpr str<Codec, Alloc>::str(const str& other) noexcept
+{
+	// copy constructor
+	if (this != &other)
+	{
+		this->capacity(other.size());
+
+		detail::__fcopy__<Codec, Codec>
+		(
+			other.__head__(),
+			other.__tail__(),
+			this->__head__()
+		);
+
+		this->__size__(other.size());
+		this->__recount__(other.__length__(), other.size());
+	}
+}
+
+template <typename Codec, typename Alloc> constexpr str<Codec, Alloc>::str(/*&*/ str&& other) noexcept
+{
+	// move constructor
+	if (this != &other)
+	{
+		std::swap
+		(
+			this->store.__union__.bytes,
+			other.store.__union__.bytes
+		);
+	}
+}
 
-	return {foo, bar};
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::operator=(const str& other) noexcept -> str&
+{
+	// copy assignment
+	if (this != &other)
+	{
+		this->capacity(other.size());
+		this->__stale__(0);
+
+		detail::__fcopy__<Codec, Codec>
+		(
+			other.__head__(),
+			other.__tail__(),
+			this->__head__()
+		);
+
+		this->__size__(other.size());
+		this->__recount__(other.__length__(), other.size());
+	}
+	return *this;
 }
 
-#pragma endregion CRTP::detail
-#pragma region SSO23
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::operator=(/*&*/ str&& other) noexcept -> str&
+{
+	// move assignment
+	if (this != &other)
+	{
+		std::swap
+		(
+			this->store.__union__.bytes,
+			other.store.__union__.bytes
+		);
+	}
+	return *this;
+}
 
-template <typename Codec, typename Alloc> constexpr str<Codec, Alloc>::buffer::operator const typename str<Codec, Alloc>::T*() const noexcept
+template <typename Codec, typename Alloc>
+template <typename Other, typename Arena> constexpr str<Codec, Alloc>::str(__OWNED__(str)) noexcept
 {
-	return this->head;
+	this->operator=(str);
 }
 
-template <typename Codec, typename Alloc> constexpr str<Codec, Alloc>::buffer::operator /*&*/ typename str<Codec, Alloc>::T*() /*&*/ noexcept
+template <typename Codec, typename Alloc>
+template <typename Other /* can't own */> constexpr str<Codec, Alloc>::str(__SLICE__(str)) noexcept
 {
-	return this->head;
+	this->operator=(str);
 }
 
-template <typename Codec, typename Alloc> constexpr str<Codec, Alloc>::storage::storage() noexcept
+template <typename Codec, typename Alloc>
+template <size_t                       N> constexpr str<Codec, Alloc>::str(__EQSTR__(str)) noexcept requires (std::is_same_v<T, char>)
 {
-	this->__union__.bytes[RMB] = MAX << SFT;
-	// std::construct_at(&this->__union__.large);
+	this->operator=(str);
 }
 
-template <typename Codec, typename Alloc> constexpr str<Codec, Alloc>::storage::~storage() noexcept
+template <typename Codec, typename Alloc>
+template <size_t                       N> constexpr str<Codec, Alloc>::str(__08STR__(str)) noexcept /* encoding of char8_t is trivial */
 {
-	if (this->mode() == LARGE)
+	this->operator=(str);
+}
+
+template <typename Codec, typename Alloc>
+template <size_t                       N> constexpr str<Codec, Alloc>::str(__16STR__(str)) noexcept /* encoding of char16_t is trivial */
+{
+	this->operator=(str);
+}
+
+template <typename Codec, typename Alloc>
+template <size_t                       N> constexpr str<Codec, Alloc>::str(__32STR__(str)) noexcept /* encoding of char32_t is trivial */
+{
+	this->operator=(str);
+}
+
+template <typename Codec, typename Alloc>
+template <typename Other, typename Arena> constexpr auto str<Codec, Alloc>::from(__OWNED__(text)) noexcept -> std::expected<str, error>
+{
+	if (const auto valid {validate(text)}; !valid) return std::unexpected {valid.error()};
+
+	return str {text};
+}
+
+template <typename Codec, typename Alloc>
+template <typename Other /* can't own */> constexpr auto str<Codec, Alloc>::from(__SLICE__(text)) noexcept -> std::expected<str, error>
+{
+	if (const auto valid {validate(text)}; !valid) return std::unexpected {valid.error()};
+
+	return str {text};
+}
+
+template <typename Codec, typename Alloc>
+template <typename Fun> requires (std::is_invocable_v<const Fun&, char32_t>) constexpr auto str<Codec, Alloc>::transform(const Fun& fun, ascii mode) /*&*/ noexcept -> str&
+{
+	// a fresh buffer; no shifting, however the widths change
+	str out;
+
+	this->transform_into(out, fun, mode);
+
+	return *this = std::move(out);
+}
+
+template <typename Codec, typename Alloc>
+template <typename Needle, typename Value> requires requires (const Needle& rhs, const Value& val) { txt {rhs}; str<Codec, Alloc> {val}; } constexpr auto str<Codec, Alloc>::replace_all(const Needle& needle, const Value& value) /*&*/ noexcept -> size_t
+{
+	return this->replace_n(needle, value, SIZE_MAX);
+}
+
+template <typename Codec, typename Alloc>
+template <typename Needle, typename Value> requires requires (const Needle& rhs, const Value& val) { txt {rhs}; str<Codec, Alloc> {val}; } constexpr auto str<Codec, Alloc>::replace_n(const Needle& needle, const Value& value, size_t n) /*&*/ noexcept -> size_t
+{
+	// transcoded once; a copy, as it may well be a slice of this very string
+	const str with {value};
+
+	return [&]<typename 𝒞𝑜𝒹𝑒𝒸>(const txt<𝒞𝑜𝒹𝑒𝒸>& slice)
 	{
-		allocator::deallocate
-		(
-			(*this),
-			(*this).__union__.large.head,
-			(*this).__union__.large.last
-			-
-			(*this).__union__.large.head
-		);
+		return this->__replace__<𝒞𝑜𝒹𝑒𝒸>(slice.__head__, slice.__tail__, with.__head__(), with.__tail__(), n);
 	}
+	(txt {needle});
 }
 
-template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::storage::mode() const noexcept -> mode_t
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::edit(/* batch */) /*&*/ noexcept -> editor
+{
+	return {this};
+}
+
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::begin() /*&*/ noexcept -> forward_iterator
+{
+	return {this, 0, (     0     ), forward_iterator::it_offset_relative_tag::HEAD,
+	                                forward_iterator::it_cursor_category_tag::LTOR};
+}
+
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::end() /*&*/ noexcept -> forward_iterator
+{
+	return {this, 0, this->length(), forward_iterator::it_offset_relative_tag::TAIL,
+	                                 forward_iterator::it_cursor_category_tag::LTOR};
+}
+
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::rbegin() /*&*/ noexcept -> reverse_iterator
+{
+	return {this, 0, (     0     ), reverse_iterator::it_offset_relative_tag::TAIL,
+	                                reverse_iterator::it_cursor_category_tag::RTOL};
+}
+
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::rend() /*&*/ noexcept -> reverse_iterator
+{
+	return {this, 0, this->length(), reverse_iterator::it_offset_relative_tag::HEAD,
+	                                 reverse_iterator::it_cursor_category_tag::RTOL};
+}
+
+template <typename Codec, typename Alloc>
+template <typename Other, typename Arena> constexpr auto str<Codec, Alloc>::operator=(__OWNED__(rhs))& noexcept -> str&
+{
+	this->__assign__<Other>(rhs.__head__(), rhs.__tail__()); return *this;
+}
+
+template <typename Codec, typename Alloc>
+template <typename Other /* can't own */> constexpr auto str<Codec, Alloc>::operator=(__SLICE__(rhs))& noexcept -> str&
+{
+	this->__assign__<Other>(rhs.__head__  , rhs.__tail__  ); return *this;
+}
+
+template <typename Codec, typename Alloc>
+template <size_t                       N> constexpr auto str<Codec, Alloc>::operator=(__EQSTR__(rhs))& noexcept -> str& requires (std::is_same_v<T, char>)
+{
+	this->__assign__<Codec>(&rhs[N - N], &rhs[N - 1]); return *this;
+}
+
+template <typename Codec, typename Alloc>
+template <size_t                       N> constexpr auto str<Codec, Alloc>::operator=(__08STR__(rhs))& noexcept -> str& /* encoding of char8_t is trivial */
+{
+	this->__assign__<codec<"UTF-8">>(&rhs[N - N], &rhs[N - 1]); return *this;
+}
+
+template <typename Codec, typename Alloc>
+template <size_t                       N> constexpr auto str<Codec, Alloc>::operator=(__16STR__(rhs))& noexcept -> str& /* encoding of char16_t is trivial */
+{
+	this->__assign__<codec<"UTF-16">>(&rhs[N - N], &rhs[N - 1]); return *this;
+}
+
+template <typename Codec, typename Alloc>
+template <size_t                       N> constexpr auto str<Codec, Alloc>::operator=(__32STR__(rhs))& noexcept -> str& /* encoding of char32_t is trivial */
+{
+	this->__assign__<codec<"UTF-32">>(&rhs[N - N], &rhs[N - 1]); return *this;
+}
+
+template <typename Codec, typename Alloc>
+template <typename Other, typename Arena> constexpr auto str<Codec, Alloc>::operator=(__OWNED__(rhs))&& noexcept -> str&&
+{
+	return std::move(this->operator=(rhs));
+}
+
+template <typename Codec, typename Alloc>
+template <typename Other /* can't own */> constexpr auto str<Codec, Alloc>::operator=(__SLICE__(rhs))&& noexcept -> str&&
+{
+	return std::move(this->operator=(rhs));
+}
+
+template <typename Codec, typename Alloc>
+template <size_t                       N> constexpr auto str<Codec, Alloc>::operator=(__EQSTR__(rhs))&& noexcept -> str&& requires (std::is_same_v<T, char>)
+{
+	return std::move(this->operator=(rhs));
+}
+
+template <typename Codec, typename Alloc>
+template <size_t                       N> constexpr auto str<Codec, Alloc>::operator=(__08STR__(rhs))&& noexcept -> str&& /* encoding of char8_t is trivial */
+{
+	return std::move(this->operator=(rhs));
+}
+
+template <typename Codec, typename Alloc>
+template <size_t                       N> constexpr auto str<Codec, Alloc>::operator=(__16STR__(rhs))&& noexcept -> str&& /* encoding of char16_t is trivial */
+{
+	return std::move(this->operator=(rhs));
+}
+
+template <typename Codec, typename Alloc>
+template <size_t                       N> constexpr auto str<Codec, Alloc>::operator=(__32STR__(rhs))&& noexcept -> str&& /* encoding of char32_t is trivial */
+{
+	return std::move(this->operator=(rhs));
+}
+
+template <typename Codec, typename Alloc>
+template <typename Other, typename Arena> constexpr auto str<Codec, Alloc>::operator+=(__OWNED__(rhs))& noexcept -> str&
+{
+	this->__concat__<Other>(rhs.__head__(), rhs.__tail__()); return *this;
+}
+
+template <typename Codec, typename Alloc>
+template <typename Other /* can't own */> constexpr auto str<Codec, Alloc>::operator+=(__SLICE__(rhs))& noexcept -> str&
+{
+	this->__concat__<Other>(rhs.__head__  , rhs.__tail__  ); return *this;
+}
+
+template <typename Codec, typename Alloc>
+template <size_t                       N> constexpr auto str<Codec, Alloc>::operator+=(__EQSTR__(rhs))& noexcept -> str& requires (std::is_same_v<T, char>)
+{
+	this->__concat__<Codec>(&rhs[N - N], &rhs[N - 1]); return *this;
+}
+
+template <typename Codec, typename Alloc>
+template <size_t                       N> constexpr auto str<Codec, Alloc>::operator+=(__08STR__(rhs))& noexcept -> str& /* encoding of char8_t is trivial */
+{
+	this->__concat__<codec<"UTF-8">>(&rhs[N - N], &rhs[N - 1]); return *this;
+}
+
+template <typename Codec, typename Alloc>
+template <size_t                       N> constexpr auto str<Codec, Alloc>::operator+=(__16STR__(rhs))& noexcept -> str& /* encoding of char16_t is trivial */
+{
+	this->__concat__<codec<"UTF-16">>(&rhs[N - N], &rhs[N - 1]); return *this;
+}
+
+template <typename Codec, typename Alloc>
+template <size_t                       N> constexpr auto str<Codec, Alloc>::operator+=(__32STR__(rhs))& noexcept -> str& /* encoding of char32_t is trivial */
+{
+	this->__concat__<codec<"UTF-32">>(&rhs[N - N], &rhs[N - 1]); return *this;
+}
+
+template <typename Codec, typename Alloc>
+template <typename Other, typename Arena> constexpr auto str<Codec, Alloc>::operator+=(__OWNED__(rhs))&& noexcept -> str&&
+{
+	return std::move(this->operator+=(rhs));
+}
+
+template <typename Codec, typename Alloc>
+template <typename Other /* can't own */> constexpr auto str<Codec, Alloc>::operator+=(__SLICE__(rhs))&& noexcept -> str&&
+{
+	return std::move(this->operator+=(rhs));
+}
+
+template <typename Codec, typename Alloc>
+template <size_t                       N> constexpr auto str<Codec, Alloc>::operator+=(__EQSTR__(rhs))&& noexcept -> str&& requires (std::is_same_v<T, char>)
+{
+	return std::move(this->operator+=(rhs));
+}
+
+template <typename Codec, typename Alloc>
+template <size_t                       N> constexpr auto str<Codec, Alloc>::operator+=(__08STR__(rhs))&& noexcept -> str&& /* encoding of char8_t is trivial */
 {
-	return static_cast<mode_t>(this->__union__.bytes[RMB] & MSK);
+	return std::move(this->operator+=(rhs));
 }
 
-template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::storage::mode() /*&*/ noexcept -> mode_t
+template <typename Codec, typename Alloc>
+template <size_t                       N> constexpr auto str<Codec, Alloc>::operator+=(__16STR__(rhs))&& noexcept -> str&& /* encoding of char16_t is trivial */
 {
-	return static_cast<mode_t>(this->__union__.bytes[RMB] & MSK);
+	return std::move(this->operator+=(rhs));
 }
 
-template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::__head__() const noexcept -> const T*
+template <typename Codec, typename Alloc>
+template <size_t                       N> constexpr auto str<Codec, Alloc>::operator+=(__32STR__(rhs))&& noexcept -> str&& /* encoding of char32_t is trivial */
 {
-	return this->store.mode() == SMALL
-	       ?
-	       this->store.__union__.small // ✨ roeses are red, violets are blue
-	       :
-	       this->store.__union__.large; // ✨ roeses are red, violets are blue
+	return std::move(this->operator+=(rhs));
 }
 
-template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::__head__() /*&*/ noexcept -> /*&*/ T*
+template <typename Codec, typename Alloc>
+template <typename Chain> requires requires (const Chain& rhs, str<Codec, Alloc>& self) { rhs.__assign__(self); } constexpr auto str<Codec, Alloc>::operator=(const Chain& rhs)& noexcept -> str&
 {
-	return this->store.mode() == SMALL
-	       ?
-	       this->store.__union__.small // ✨ roeses are red, violets are blue
-	       :
-	       this->store.__union__.large; // ✨ roeses are red, violets are blue
+	rhs.__assign__(*this); return *this;
 }
 
-template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::__tail__() const noexcept -> const T*
+template <typename Codec, typename Alloc>
+template <typename Chain> requires requires (const Chain& rhs, str<Codec, Alloc>& self) { rhs.__assign__(self); } constexpr auto str<Codec, Alloc>::operator=(const Chain& rhs)&& noexcept -> str&&
 {
-	return this->store.mode() == SMALL
-	       ?
-	       &this->store.__union__.small[MAX - (this->store.__union__.bytes[RMB] >> SFT)]
-	       :
-	       &this->store.__union__.large[this->store.__union__.large.size /* read-as-is */];
+	return std::move(this->operator=(rhs));
 }
 
-template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::__tail__() /*&*/ noexcept -> /*&*/ T*
+template <typename Codec, typename Alloc>
+template <typename Chain> requires requires (const Chain& rhs, str<Codec, Alloc>& self) { rhs.__concat__(self); } constexpr auto str<Codec, Alloc>::operator+=(const Chain& rhs)& noexcept -> str&
 {
-	return this->store.mode() == SMALL
-	       ?
-	       &this->store.__union__.small[MAX - (this->store.__union__.bytes[RMB] >> SFT)]
-	       :
-	       &this->store.__union__.large[this->store.__union__.large.size /* read-as-is */];
+	rhs.__concat__(*this); return *this;
 }
 
-template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::__last__() const noexcept -> const T*
+template <typename Codec, typename Alloc>
+template <typename Chain> requires requires (const Chain& rhs, str<Codec, Alloc>& self) { rhs.__concat__(self); } constexpr auto str<Codec, Alloc>::operator+=(const Chain& rhs)&& noexcept -> str&&
 {
-	return this->store.mode() == SMALL
-	       ?
-	       &this->store.__union__.small[MAX] // ✨ roeses are red, violets are blue
-	       :
-	       this->store.__union__.large.last; // ✨ roeses are red, violets are blue
+	return std::move(this->operator+=(rhs));
 }
 
-template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::__last__() /*&*/ noexcept -> /*&*/ T*
+template <typename Codec, typename Alloc>
+template <typename Other /* can't own */> constexpr auto str<Codec, Alloc>::__assign__(const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> __assign__t
 {
-	return this->store.mode() == SMALL
-	       ?
-	       &this->store.__union__.small[MAX] // ✨ roeses are red, violets are blue
-	       :
-	       this->store.__union__.large.last; // ✨ roeses are red, violets are blue
+	const auto bound {detail::__bound__<Codec, Other>(rhs_0, rhs_N)};
+	// a buffer already large enough is reused as is
+	const auto alloc {this->capacity() < bound};
+
+	// allocate for the worst case, then transcode once
+	this->capacity(bound);
+	this->__stale__(0);
+
+	const auto size
+	{
+		detail::__fcopy__<Codec,
+		                  Other>
+		(
+			rhs_0, // &rhs[0]
+			rhs_N, // &rhs[N]
+			this->__head__()
+		)
+	};
+
+	this->__size__(size);
+
+	if (alloc) { this->__trim__(); }
+
+	this->__recount__(0, 0);
 }
 
-template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::capacity(/* getter */) const noexcept -> size_t
+template <typename Codec, typename Alloc>
+template <typename Other /* can't own */> constexpr auto str<Codec, Alloc>::__concat__(const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> __concat__t
 {
-	return this->store.mode() == SMALL
-	       ?
-	       MAX // or calculate the ptrdiff_t just as large mode as shown down below
-	       :
-	       this->store.__union__.large.last - this->store.__union__.large.head - 1;
+	const auto prev {this->__length__()};
+	const auto from {this->size()};
+
+	const auto bound {this->size() + detail::__bound__<Codec, Other>(rhs_0, rhs_N)};
+	// a buffer already large enough is reused as is
+	const auto alloc {this->capacity() < bound};
+
+	// room for the worst case, then transcode once; amortized
+	this->reserve(bound);
+
+	const auto size
+	{
+		detail::__fcopy__<Codec,
+		                  Other>
+		(
+			rhs_0, // &rhs[0]
+			rhs_N, // &rhs[N]
+			this->__tail__()
+		)
+	};
+
+	this->__size__(this->size() + size);
+
+	if (alloc) { this->__trim__(); }
+
+	this->__recount__(prev, from);
 }
 
-template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::capacity(size_t value) /*&*/ noexcept -> void
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::__insert__(T* dest, char32_t code, int8_t step) noexcept -> __insert__t
 {
-	if (this->capacity() < value)
+	__insert__t out
 	{
-		T* head {allocator::allocate(this->store, value + 1)};
-		T* tail {/* <one-past-the-end!> */(head + value + 1)};
+		.shift {false},
+		.alloc {false},
+		.reuse {dest},
+	};
 
-		const auto size {this->size()};
+	const auto a // with T=int8_t
+	{
+		0 < step
+		?
+		static_cast<int8_t>(+step)
+		:
+		static_cast<int8_t>(-step)
+	};
 
-		detail::__fcopy__<Codec, Codec>
-		(
-			this->__head__(),
-			this->__tail__(),
-			head // dest
-		);
+	const auto b {Codec::size(code)};
 
-		if (this->store.mode() == LARGE)
+	// one code point for another; the count stays as is
+	const auto count {this->__length__()};
+
+	// where the code point starts; the breadcrumbs past it move by b - a
+	const auto from {static_cast<size_t>((0 < step ? dest : dest - a) - this->__head__())};
+
+	if (a == b)
+	{
+		// no need to shift buffer :D
+		Codec::encode(code, dest, step);
+	}
+	else if (a < b)
+	{
+		out.shift = true;
+
+		const T* tail {this->__tail__()};
+
+		const auto old_l {this->size()};
+		const auto new_l {old_l - a+b };
+
+		if (this->capacity() < new_l)
 		{
-			allocator::deallocate
+			out.alloc = true;
+
+			/**/ if (0 < step)
+			{
+				const auto dif {dest - this->__head__()};
+
+				// amortized; see growth
+				this->reserve(new_l);
+
+				dest = this->__head__() + dif;
+				tail = this->__tail__()      ;
+			}
+			else if (step < 0)
+			{
+				const auto dif {this->__tail__() - dest};
+
+				// amortized; see growth
+				this->reserve(new_l);
+
+				dest = this->__tail__() - dif;
+				tail = this->__tail__()      ;
+			}
+		}
+
+		/**/ if (0 < step)
+		{
+			out.reuse = dest;
+
+			//                       dest
+			//                       ↓
+			//┌────────┬─────────────┬───┬──────────────┬────────┐
+			//│ <head> │ left buffer │ A │ right buffer │ <tail> │
+			//├────────┼─────────────┼───┴───┬──────────┴───┬────┴───┐
+			//│ <head> │ left buffer │ [[B]] │ right buffer │ <tail> │
+			//└────────┴─────────────┴───────┴──────────────┴────────┘
+			//                       ↑
+			//                       out.reuse
+
+			detail::__rcopy__<Codec,
+			                  Codec>
 			(
-				this->store,
-				this->store.__union__.large.head,
-				this->store.__union__.large.last
-				-
-				this->store.__union__.large.head
+				dest + a,
+				tail + 0,
+				dest + b
+			);
+			this->__size__(new_l);
+
+			// write code point at proper ptr
+			Codec::encode(code, out.reuse, +b);
+		}
+		else if (step < 0)
+		{
+			out.reuse = dest - a + b;
+
+			//                           dest
+			//                           ↓
+			//┌────────┬─────────────┬───┬──────────────┬────────┐
+			//│ <head> │ left buffer │ A │ right buffer │ <tail> │
+			//├────────┼─────────────┼───┴───┬──────────┴───┬────┴───┐
+			//│ <head> │ left buffer │ [[B]] │ right buffer │ <tail> │
+			//└────────┴─────────────┴───────┴──────────────┴────────┘
+			//                               ↑
+			//                               out.reuse
+
+			detail::__rcopy__<Codec,
+			                  Codec>
+			(
+				dest - 0 + 0,
+				tail - 0 + 0,
+				dest - a + b
+			);
+			this->__size__(new_l);
+
+			// write code point at proper ptr
+			Codec::encode(code, out.reuse, -b);
+		}
+	}
+	else if (b < a)
+	{
+		out.shift = true;
+
+		const T* tail {this->__tail__()};
+
+		const auto old_l {this->size()};
+		const auto new_l {old_l - a+b };
+
+		/**/ if (0 < step)
+		{
+			out.reuse = dest;
+
+			//                       dest
+			//                       ↓
+			//┌────────┬─────────────┬───────┬──────────────┬────────┐
+			//│ <head> │ left buffer │ [[A]] │ right buffer │ <tail> │
+			//├────────┼─────────────┼───┬───┴──────────┬───┴────┬───┘
+			//│ <head> │ left buffer │ B │ right buffer │ <tail> │
+			//└────────┴─────────────┴───┴──────────────┴────────┘
+			//                       ↑
+			//                       out.reuse
+
+			detail::__fcopy__<Codec,
+			                  Codec>
+			(
+				dest + a,
+				tail + 0,
+				dest + b
 			);
+			this->__size__(new_l);
+
+			// write code point at proper ptr
+			Codec::encode(code, out.reuse, +b);
 		}
+		else if (step < 0)
+		{
+			out.reuse = dest - a + b;
+
+			//                               dest
+			//                               ↓
+			//┌────────┬─────────────┬───────┬──────────────┬────────┐
+			//│ <head> │ left buffer │ [[A]] │ right buffer │ <tail> │
+			//├────────┼─────────────┼───┬───┴──────────┬───┴────┬───┘
+			//│ <head> │ left buffer │ B │ right buffer │ <tail> │
+			//└────────┴─────────────┴───┴──────────────┴────────┘
+			//                           ↑
+			//                           out.reuse
+
+			detail::__fcopy__<Codec,
+			                  Codec>
+			(
+				dest - 0 + 0,
+				tail - 0 + 0,
+				dest - a + b
+			);
+			this->__size__(new_l);
 
-		std::construct_at(&this->store.__union__.large);
-		{
-			this->store.__union__.large.head = head;
-			this->store.__union__.large.last = tail;
-			this->store.__union__.large.size = size;
-			this->store.__union__.large.meta = LARGE;
+			// write code point at proper ptr
+			Codec::encode(code, out.reuse, -b);
 		}
 	}
+
+	if (a != b)
+	{
+		this->__shift__(from, b - a);
+		this->__length__(count);
+	}
+	return out;
 }
 
-template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::__size__(size_t value) noexcept -> void
+template <typename Codec, typename Alloc>
+template <typename Other /* can't own */> constexpr auto str<Codec, Alloc>::__replace__(const typename Other::T* rhs_0, const typename Other::T* rhs_N, const T* val_0, const T* val_N, size_t n) noexcept -> size_t
 {
-	switch (this->store.mode())
-	{
-		case SMALL:
-		{
-			const auto slot {(MAX - value) << SFT};
+	T* head {this->__head__()};
+	T* tail {this->__tail__()};
 
-			//┌────────────┐    ┌───────[LE]───────┐
-			//│ 0b0XXXXXXX │ -> │ no need for skip │
-			//└────────────┘    └──────────────────┘
+	// where every match starts; the scanner runs once, before anything moves
+	std::vector<size_t> hits;
+	// a needle is transcoded once; every match is as long
+	size_t len {0};
 
-			//┌────────────┐    ┌───────[BE]───────┐
-			//│ 0bXXXXXXX0 │ -> │ skip right 1 bit │
-			//└────────────┘    └──────────────────┘
+	if (0 < n)
+	{
+		detail::__scan__<Codec, Other>(head, tail,
+		                               rhs_0, rhs_N,
+			// on every distinct match found, up to the nth
+			[&](const T* lhs, const T* rhs)
+			{
+				hits.push_back(static_cast<size_t>(lhs - head)); len = rhs - lhs; return hits.size() < n;
+			}
+		);
+	}
 
-			this->store.__union__.bytes[RMB] = slot;
-			this->store.__union__.small[value] = '\0';
-			break;
-		}
-		case LARGE:
-		{
-			this->store.__union__.large.size = value;
-			this->store.__union__.large[value] = '\0';
-			break;
-		}
+	if (hits.empty())
+	{
+		return 0;
 	}
-}
 
-#pragma endregion SSO23
-#pragma region str
+	const auto val {static_cast<size_t>(val_N - val_0)};
 
-template <typename Codec, typename Alloc> constexpr str<Codec, Alloc>::operator const T*() const noexcept
-{
-	return this->__head__();
-}
+	const auto old_l {this->size()};
+	const auto new_l {old_l - hits.size() * len + hits.size() * val};
 
-template <typename Codec, typename Alloc> constexpr str<Codec, Alloc>::operator /*&*/ T*() /*&*/ noexcept
-{
-	return this->__head__();
-}
+	// code points in and out per match; only if the count is kept
+	const auto prev {this->__length__()};
+	const auto a {prev.has_value() ? detail::__difcp__<Codec>(head + hits[0], head + hits[0] + len) : 0};
+	const auto b {prev.has_value() ? detail::__difcp__<Codec>(val_0 /*&&&&&&&&&&&&&&&&*/, val_N) : 0};
 
-template <typename Codec, typename Alloc> constexpr str<Codec, Alloc>::str(const str& other) noexcept
-{
-	// copy constructor
-	if (this != &other)
+	/**/ if (val <= len)
 	{
-		this->capacity(other.size());
+		// shrinks; left to right, the output never overtakes the input
+		T* out {head + hits[0]};
 
-		detail::__fcopy__<Codec, Codec>
-		(
-			other.__head__(),
-			other.__tail__(),
-			this->__head__()
-		);
+		for (size_t i {0}; i < hits.size(); ++i)
+		{
+			const T* from {head + hits[i] + len};
+			const T* next {i + 1 < hits.size() ? head + hits[i + 1] : tail};
 
-		this->__size__(other.size());
-	}
-}
+			out = std::copy(val_0, val_N, out);
 
-template <typename Codec, typename Alloc> constexpr str<Codec, Alloc>::str(/*&*/ str&& other) noexcept
-{
-	// move constructor
-	if (this != &other)
-	{
-		std::swap
-		(
-			this->store.__union__.bytes,
-			other.store.__union__.bytes
-		);
+			if (out != from)
+			{
+				out = std::copy(from, next, out);
+			}
+			else
+			{
+				out += next - from;
+			}
+		}
+
+		this->__size__(new_l);
+		this->__stale__(hits[0]);
 	}
-}
+	else if (new_l <= this->capacity())
+	{
+		// grows in place; right to left, the output never overtakes the input
+		T* out {head + new_l};
 
-template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::operator=(const str& other) noexcept -> str&
-{
-	// copy assignment
-	if (this != &other)
+		for (size_t i {hits.size()}; 0 < i--; )
+		{
+			const T* from {head + hits[i] + len};
+			const T* next {i + 1 < hits.size() ? head + hits[i + 1] : tail};
+
+			out = std::copy_backward(from, next, out);
+			out = std::copy_backward(val_0, val_N, out);
+		}
+
+		this->__size__(new_l);
+		this->__stale__(hits[0]);
+	}
+	else
 	{
-		this->capacity(other.size());
+		// grows; one allocation, of the exact size
+		str out;
 
-		detail::__fcopy__<Codec, Codec>
-		(
-			other.__head__(),
-			other.__tail__(),
-			this->__head__()
-		);
+		out.capacity(new_l);
 
-		this->__size__(other.size());
+		T* ptr {out.__head__()};
+		const T* last {head};
+
+		for (const auto hit : hits)
+		{
+			ptr = std::copy(last, static_cast<const T*>(head + hit), ptr);
+			ptr = std::copy(val_0, val_N, ptr);
+
+			last = head + hit + len;
+		}
+		std::copy(last, static_cast<const T*>(tail), ptr);
+
+		out.__size__(new_l);
+
+		*this = std::move(out);
 	}
-	return *this;
-}
 
-template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::operator=(/*&*/ str&& other) noexcept -> str&
-{
-	// move assignment
-	if (this != &other)
+	if (prev.has_value())
 	{
-		std::swap
-		(
-			this->store.__union__.bytes,
-			other.store.__union__.bytes
-		);
+		this->__length__(*prev - hits.size() * a + hits.size() * b);
+	}
+	else
+	{
+		this->__recount__(std::nullopt, 0);
 	}
-	return *this;
-}
-
-template <typename Codec, typename Alloc>
-template <typename Other, typename Arena> constexpr str<Codec, Alloc>::str(__OWNED__(str)) noexcept
-{
-	this->operator=(str);
-}
 
-template <typename Codec, typename Alloc>
-template <typename Other /* can't own */> constexpr str<Codec, Alloc>::str(__SLICE__(str)) noexcept
-{
-	this->operator=(str);
+	return hits.size();
 }
 
-template <typename Codec, typename Alloc>
-template <size_t                       N> constexpr str<Codec, Alloc>::str(__EQSTR__(str)) noexcept requires (std::is_same_v<T, char>)
-{
-	this->operator=(str);
-}
+#pragma endregion str
+#pragma region str::cursor
 
-template <typename Codec, typename Alloc>
-template <size_t                       N> constexpr str<Codec, Alloc>::str(__08STR__(str)) noexcept /* encoding of char8_t is trivial */
+template <typename Codec, typename Alloc> template <typename Iterator> constexpr auto str<Codec, Alloc>::cursor<Iterator>::__needle__() const noexcept -> T*
 {
-	this->operator=(str);
-}
+	switch (this->offset_tag)
+	{
+		case it_offset_relative_tag::HEAD:
+		{
+			return this->src->__head__() + this->offset;
+		}
+		case it_offset_relative_tag::TAIL:
+		{
+			return this->src->__tail__() - this->offset;
+		}
+	}
 
-template <typename Codec, typename Alloc>
-template <size_t                       N> constexpr str<Codec, Alloc>::str(__16STR__(str)) noexcept /* encoding of char16_t is trivial */
-{
-	this->operator=(str);
+	assert(!"segfault");
+	std::unreachable();
 }
 
-template <typename Codec, typename Alloc>
-template <size_t                       N> constexpr str<Codec, Alloc>::str(__32STR__(str)) noexcept /* encoding of char32_t is trivial */
+template <typename Codec, typename Alloc> template <typename Iterator> constexpr auto str<Codec, Alloc>::cursor<Iterator>::operator*() const noexcept -> value_type
 {
-	this->operator=(str);
+	return {this->src, this->__needle__(), this->cursor_tag};
 }
 
-template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::begin() /*&*/ noexcept -> forward_iterator
+template <typename Codec, typename Alloc> template <typename Iterator> constexpr auto str<Codec, Alloc>::cursor<Iterator>::operator++(   ) noexcept -> Iterator&
 {
-	return {this, this->__head__(), 0, (     0     ), forward_iterator::it_offset_relative_tag::HEAD,
-	                                                  forward_iterator::it_cursor_category_tag::LTOR};
-}
+	const T* ptr {this->__needle__()};
 
-template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::end() /*&*/ noexcept -> forward_iterator
-{
-	return {this, this->__tail__(), 0, this->length(), forward_iterator::it_offset_relative_tag::TAIL,
-	                                                   forward_iterator::it_cursor_category_tag::LTOR};
-}
+	++this->weight;
 
-template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::rbegin() /*&*/ noexcept -> reverse_iterator
-{
-	return {this, this->__tail__(), 0, (     0     ), reverse_iterator::it_offset_relative_tag::TAIL,
-	                                                  reverse_iterator::it_cursor_category_tag::RTOL};
-}
+	switch (this->cursor_tag)
+	{
+		case it_cursor_category_tag::LTOR:
+		{
+			this->offset += Codec::next(ptr);
+			break;
+		}
+		case it_cursor_category_tag::RTOL:
+		{
+			this->offset -= Codec::back(ptr);
+			break;
+		}
+	}
 
-template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::rend() /*&*/ noexcept -> reverse_iterator
-{
-	return {this, this->__head__(), 0, this->length(), reverse_iterator::it_offset_relative_tag::HEAD,
-	                                                   reverse_iterator::it_cursor_category_tag::RTOL};
+	return static_cast<Iterator&>(*this);
 }
 
-template <typename Codec, typename Alloc>
-template <typename Other, typename Arena> constexpr auto str<Codec, Alloc>::operator=(__OWNED__(rhs))& noexcept -> str&
+template <typename Codec, typename Alloc> template <typename Iterator> constexpr auto str<Codec, Alloc>::cursor<Iterator>::operator++(int) noexcept -> Iterator
 {
-	this->__assign__<Other>(rhs.__head__(), rhs.__tail__()); return *this;
-}
+	cursor clone {*this}; ++(*this);
 
-template <typename Codec, typename Alloc>
-template <typename Other /* can't own */> constexpr auto str<Codec, Alloc>::operator=(__SLICE__(rhs))& noexcept -> str&
-{
-	this->__assign__<Other>(rhs.__head__  , rhs.__tail__  ); return *this;
+	return static_cast<Iterator>(clone);
 }
 
-template <typename Codec, typename Alloc>
-template <size_t                       N> constexpr auto str<Codec, Alloc>::operator=(__EQSTR__(rhs))& noexcept -> str& requires (std::is_same_v<T, char>)
+template <typename Codec, typename Alloc> template <typename Iterator> constexpr auto str<Codec, Alloc>::cursor<Iterator>::operator--(   ) noexcept -> Iterator&
 {
-	this->__assign__<Codec>(&rhs[N - N], &rhs[N - 1]); return *this;
-}
+	const T* ptr {this->__needle__()};
 
-template <typename Codec, typename Alloc>
-template <size_t                       N> constexpr auto str<Codec, Alloc>::operator=(__08STR__(rhs))& noexcept -> str& /* encoding of char8_t is trivial */
-{
-	this->__assign__<codec<"UTF-8">>(&rhs[N - N], &rhs[N - 1]); return *this;
-}
+	--this->weight;
 
-template <typename Codec, typename Alloc>
-template <size_t                       N> constexpr auto str<Codec, Alloc>::operator=(__16STR__(rhs))& noexcept -> str& /* encoding of char16_t is trivial */
-{
-	this->__assign__<codec<"UTF-16">>(&rhs[N - N], &rhs[N - 1]); return *this;
-}
+	switch (this->cursor_tag)
+	{
+		case it_cursor_category_tag::LTOR:
+		{
+			this->offset -= Codec::back(ptr);
+			break;
+		}
+		case it_cursor_category_tag::RTOL:
+		{
+			this->offset += Codec::next(ptr);
+			break;
+		}
+	}
 
-template <typename Codec, typename Alloc>
-template <size_t                       N> constexpr auto str<Codec, Alloc>::operator=(__32STR__(rhs))& noexcept -> str& /* encoding of char32_t is trivial */
-{
-	this->__assign__<codec<"UTF-32">>(&rhs[N - N], &rhs[N - 1]); return *this;
+	return static_cast<Iterator&>(*this);
 }
 
-template <typename Codec, typename Alloc>
-template <typename Other, typename Arena> constexpr auto str<Codec, Alloc>::operator=(__OWNED__(rhs))&& noexcept -> str&&
+template <typename Codec, typename Alloc> template <typename Iterator> constexpr auto str<Codec, Alloc>::cursor<Iterator>::operator--(int) noexcept -> Iterator
 {
-	return std::move(this->operator=(rhs));
-}
+	cursor clone {*this}; --(*this);
 
-template <typename Codec, typename Alloc>
-template <typename Other /* can't own */> constexpr auto str<Codec, Alloc>::operator=(__SLICE__(rhs))&& noexcept -> str&&
-{
-	return std::move(this->operator=(rhs));
+	return static_cast<Iterator>(clone);
 }
 
-template <typename Codec, typename Alloc>
-template <size_t                       N> constexpr auto str<Codec, Alloc>::operator=(__EQSTR__(rhs))&& noexcept -> str&& requires (std::is_same_v<T, char>)
+template <typename Codec, typename Alloc> template <typename Iterator> constexpr auto str<Codec, Alloc>::cursor<Iterator>::operator+(size_t value) noexcept -> Iterator
 {
-	return std::move(this->operator=(rhs));
-}
+	cursor clone {*this}; clone += value;
 
-template <typename Codec, typename Alloc>
-template <size_t                       N> constexpr auto str<Codec, Alloc>::operator=(__08STR__(rhs))&& noexcept -> str&& /* encoding of char8_t is trivial */
-{
-	return std::move(this->operator=(rhs));
+	return static_cast<Iterator>(clone);
 }
 
-template <typename Codec, typename Alloc>
-template <size_t                       N> constexpr auto str<Codec, Alloc>::operator=(__16STR__(rhs))&& noexcept -> str&& /* encoding of char16_t is trivial */
+template <typename Codec, typename Alloc> template <typename Iterator> constexpr auto str<Codec, Alloc>::cursor<Iterator>::operator-(size_t value) noexcept -> Iterator
 {
-	return std::move(this->operator=(rhs));
+	cursor clone {*this};
+
+	for (size_t i {0}; i < value; ++i) { --clone; }
+
+	return static_cast<Iterator>(clone);
 }
 
-template <typename Codec, typename Alloc>
-template <size_t                       N> constexpr auto str<Codec, Alloc>::operator=(__32STR__(rhs))&& noexcept -> str&& /* encoding of char32_t is trivial */
+template <typename Codec, typename Alloc> template <typename Iterator> constexpr auto str<Codec, Alloc>::cursor<Iterator>::operator+=(size_t value) noexcept -> Iterator&
 {
-	return std::move(this->operator=(rhs));
+	if (this->offset_tag == it_offset_relative_tag::HEAD
+	    &&
+	    this->cursor_tag == it_cursor_category_tag::LTOR)
+	{
+		// from the head, weight is the code point index; jump by the side index
+		const T* ptr {this->src->__seek__(this->weight + value)};
+
+		this->offset = static_cast<size_t>(ptr - this->src->__head__());
+		this->weight += value;
+	}
+	else
+	{
+		for (size_t i {0}; i < value; ++i) { ++(*this); }
+	}
+	return static_cast<Iterator&>(*this);
 }
 
-template <typename Codec, typename Alloc>
-template <typename Other, typename Arena> constexpr auto str<Codec, Alloc>::operator+=(__OWNED__(rhs))& noexcept -> str&
+template <typename Codec, typename Alloc> template <typename Iterator> constexpr auto str<Codec, Alloc>::cursor<Iterator>::operator-=(size_t value) noexcept -> Iterator&
 {
-	this->__concat__<Other>(rhs.__head__(), rhs.__tail__()); return *this;
+	for (size_t i {0}; i < value; ++i) { --(*this); }
+
+	return static_cast<Iterator&>(*this);
 }
 
-template <typename Codec, typename Alloc>
-template <typename Other /* can't own */> constexpr auto str<Codec, Alloc>::operator+=(__SLICE__(rhs))& noexcept -> str&
+template <typename Codec, typename Alloc> template <typename Iterator> constexpr auto str<Codec, Alloc>::cursor<Iterator>::operator==(const Iterator& rhs) const noexcept -> bool
 {
-	this->__concat__<Other>(rhs.__head__  , rhs.__tail__  ); return *this;
+	// short-circuit; delay ptr comparison
+
+	return this->weight == rhs.weight // delta
+	       &&
+	       this->src == rhs.src;
 }
 
-template <typename Codec, typename Alloc>
-template <size_t                       N> constexpr auto str<Codec, Alloc>::operator+=(__EQSTR__(rhs))& noexcept -> str& requires (std::is_same_v<T, char>)
+template <typename Codec, typename Alloc> template <typename Iterator> constexpr auto str<Codec, Alloc>::cursor<Iterator>::operator!=(const Iterator& rhs) const noexcept -> bool
 {
-	this->__concat__<Codec>(&rhs[N - N], &rhs[N - 1]); return *this;
+	// short-circuit; delay ptr comparison
+
+	return this->weight != rhs.weight // delta
+	       ||
+	       this->src != rhs.src;
 }
 
-template <typename Codec, typename Alloc>
-template <size_t                       N> constexpr auto str<Codec, Alloc>::operator+=(__08STR__(rhs))& noexcept -> str& /* encoding of char8_t is trivial */
+template <typename Codec, typename Alloc> template <typename Iterator> [[nodiscard]] constexpr str<Codec, Alloc>::cursor<Iterator>::proxy::operator char32_t() const noexcept
 {
-	this->__concat__<codec<"UTF-8">>(&rhs[N - N], &rhs[N - 1]); return *this;
+	char32_t code;
+
+	switch (this->cursor_tag)
+	{
+		case it_cursor_category_tag::LTOR:
+		{
+			Codec::decode(this->needle, code, Codec::next(this->needle));
+			break;
+		}
+		case it_cursor_category_tag::RTOL:
+		{
+			Codec::decode(this->needle, code, Codec::back(this->needle));
+			break;
+		}
+	}
+	return code;
 }
 
-template <typename Codec, typename Alloc>
-template <size_t                       N> constexpr auto str<Codec, Alloc>::operator+=(__16STR__(rhs))& noexcept -> str& /* encoding of char16_t is trivial */
+template <typename Codec, typename Alloc> template <typename Iterator> constexpr auto str<Codec, Alloc>::cursor<Iterator>::proxy::operator=(char32_t code) noexcept -> proxy&
 {
-	this->__concat__<codec<"UTF-16">>(&rhs[N - N], &rhs[N - 1]); return *this;
+	int8_t step;
+
+	// examine way
+	switch (this->cursor_tag)
+	{
+		case it_cursor_category_tag::LTOR:
+		{
+			step = Codec::next(this->needle);
+			break;
+		}
+		case it_cursor_category_tag::RTOL:
+		{
+			step = Codec::back(this->needle);
+			break;
+		}
+	}
+
+	// the anchor is read afresh on every access; only the needle may be stale
+	this->needle = this->src->__insert__(this->needle, code, step).reuse;
+
+	return *this;
 }
 
-template <typename Codec, typename Alloc>
-template <size_t                       N> constexpr auto str<Codec, Alloc>::operator+=(__32STR__(rhs))& noexcept -> str& /* encoding of char32_t is trivial */
+template <typename Codec, typename Alloc> template <typename Iterator> constexpr auto str<Codec, Alloc>::cursor<Iterator>::proxy::operator==(char32_t code) const noexcept -> bool
 {
-	this->__concat__<codec<"UTF-32">>(&rhs[N - N], &rhs[N - 1]); return *this;
+	return this->operator char32_t() == code;
 }
 
-template <typename Codec, typename Alloc>
-template <typename Other, typename Arena> constexpr auto str<Codec, Alloc>::operator+=(__OWNED__(rhs))&& noexcept -> str&&
+template <typename Codec, typename Alloc> template <typename Iterator> constexpr auto str<Codec, Alloc>::cursor<Iterator>::proxy::operator!=(char32_t code) const noexcept -> bool
 {
-	return std::move(this->operator+=(rhs));
+	return this->operator char32_t() != code;
 }
 
-template <typename Codec, typename Alloc>
-template <typename Other /* can't own */> constexpr auto str<Codec, Alloc>::operator+=(__SLICE__(rhs))&& noexcept -> str&&
+#pragma endregion str::cursor
+#pragma region str::reader
+
+template <typename Codec, typename Alloc> [[nodiscard]] constexpr str<Codec, Alloc>::reader::operator char32_t() const noexcept
 {
-	return std::move(this->operator+=(rhs));
+	const T* head {this->src->__seek__(this->arg)};
+	const T* tail {this->src->__tail__()};
+
+	if (head < tail)
+	{
+		char32_t code;
+
+		const auto step {Codec::next(head)};
+		Codec::decode(head, code, step);
+
+		return code;
+	}
+	return U'\0';
 }
 
-template <typename Codec, typename Alloc>
-template <size_t                       N> constexpr auto str<Codec, Alloc>::operator+=(__EQSTR__(rhs))&& noexcept -> str&& requires (std::is_same_v<T, char>)
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::reader::operator==(char32_t code) const noexcept -> bool
 {
-	return std::move(this->operator+=(rhs));
+	return this->operator char32_t() == code;
 }
 
-template <typename Codec, typename Alloc>
-template <size_t                       N> constexpr auto str<Codec, Alloc>::operator+=(__08STR__(rhs))&& noexcept -> str&& /* encoding of char8_t is trivial */
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::reader::operator!=(char32_t code) const noexcept -> bool
 {
-	return std::move(this->operator+=(rhs));
+	return this->operator char32_t() != code;
 }
 
-template <typename Codec, typename Alloc>
-template <size_t                       N> constexpr auto str<Codec, Alloc>::operator+=(__16STR__(rhs))&& noexcept -> str&& /* encoding of char16_t is trivial */
+#pragma endregion str::reader
+#pragma region str::writer
+
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::writer::operator=(char32_t code) noexcept -> writer&
 {
-	return std::move(this->operator+=(rhs));
+	/*&*/ T* head {this->src->__head__()};
+	const T* tail {this->src->__tail__()};
+
+	if (const T* ptr {this->src->__seek__(this->arg)}; ptr < tail)
+	{
+		head += ptr - head;
+
+		const auto step {Codec::next(head)};
+		// nothing to refresh; the next access seeks anew
+		std::ignore = this->src->__insert__(head, code, step);
+	}
+	return *this;
 }
 
-template <typename Codec, typename Alloc>
-template <size_t                       N> constexpr auto str<Codec, Alloc>::operator+=(__32STR__(rhs))&& noexcept -> str&& /* encoding of char32_t is trivial */
+template <typename Codec, typename Alloc> [[nodiscard]] constexpr str<Codec, Alloc>::writer::operator char32_t() const noexcept
 {
-	return std::move(this->operator+=(rhs));
+	// a mutable string may grow its index; a reader only ever walks it
+	this->src->__index__(this->arg);
+
+	return reader {this->src, this->arg}.operator char32_t();
 }
 
-template <typename Codec, typename Alloc>
-template <typename Other /* can't own */> constexpr auto str<Codec, Alloc>::__assign__(const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> __assign__t
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::writer::operator==(char32_t code) const noexcept -> bool
 {
-	const txt<Other> rhs {rhs_0, rhs_N};
+	return reader {this->src, this->arg}.operator==(code);
+}
 
-	size_t size {0};
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::writer::operator!=(char32_t code) const noexcept -> bool
+{
+	return reader {this->src, this->arg}.operator!=(code);
+}
 
-	if constexpr (std::is_same_v<Codec, Other>) { size += rhs.size(); }
-	else { for (const auto code : rhs) { size += Codec::size(code); } }
-	
-	// size += this->size();
+#pragma endregion str::writer
+#pragma region str::editor
 
-	this->capacity(size);
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::editor::replace(size_t nth, char32_t code) noexcept -> editor&
+{
+	// no string is that long
+	if (nth < SIZE_MAX)
+	{
+		const auto head {this->pool.size()};
+		const auto step {Codec::size(code)};
 
-	detail::__fcopy__<Codec,
-	                  Other>
-	(
-		rhs_0, // &rhs[0]
-		rhs_N, // &rhs[N]
-		this->__head__()
-	);
+		this->pool.resize(head + step);
+		Codec::encode(code, this->pool.data() + head, step);
 
-	this->__size__(size);
+		this->edits.push_back({nth, nth + 1, head, this->pool.size()});
+	}
+	return *this;
 }
 
 template <typename Codec, typename Alloc>
-template <typename Other /* can't own */> constexpr auto str<Codec, Alloc>::__concat__(const typename Other::T* rhs_0, const typename Other::T* rhs_N) noexcept -> __concat__t
+template <typename Value> requires requires (const Value& val) { str<Codec, Alloc> {val}; } constexpr auto str<Codec, Alloc>::editor::insert(size_t nth, const Value& value) noexcept -> editor&
 {
-	const txt<Other> rhs {rhs_0, rhs_N};
-
-	size_t size {0};
+	// transcoded now; it may well be a slice of the very string it goes into
+	const str with {value};
 
-	if constexpr (std::is_same_v<Codec, Other>) { size += rhs.size(); }
-	else { for (const auto code : rhs) { size += Codec::size(code); } }
-	
-	size += this->size();
+	const auto head {this->pool.size()};
 
-	this->capacity(size);
+	this->pool.insert(this->pool.end(), with.__head__(), with.__tail__());
 
-	detail::__fcopy__<Codec,
-	                  Other>
-	(
-		rhs_0, // &rhs[0]
-		rhs_N, // &rhs[N]
-		this->__tail__()
-	);
+	this->edits.push_back({nth, nth, head, this->pool.size()});
 
-	this->__size__(size);
+	return *this;
 }
 
-template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::__insert__(T* dest, char32_t code, int8_t step) noexcept -> __insert__t
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::editor::erase(size_t nth, size_t n) noexcept -> editor&
 {
-	__insert__t out
-	{
-		.shift {false},
-		.alloc {false},
-		.reuse {dest},
-	};
-
-	const auto a // with T=int8_t
+	if (0 < n)
 	{
-		0 < step
-		?
-		static_cast<int8_t>(+step)
-		:
-		static_cast<int8_t>(-step)
-	};
+		this->edits.push_back({nth, nth + std::min(n, SIZE_MAX - nth), 0, 0});
+	}
+	return *this;
+}
 
-	const auto b {Codec::size(code)};
+template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::editor::commit() noexcept -> str&
+{
+	auto& edits {this->edits};
 
-	if (a == b)
+	if (edits.empty())
 	{
-		// no need to shift buffer :D
-		Codec::encode(code, dest, step);
+		return *this->src;
 	}
-	else if (a < b)
+
+	// by position; at the same spot, inserts go first, and ties keep their order
+	std::ranges::stable_sort(edits, [](const splice& lhs, const splice& rhs)
 	{
-		out.shift = true;
+		return lhs.from != rhs.from ? lhs.from < rhs.from : lhs.until < rhs.until;
+	});
 
-		const T* tail {this->__tail__()};
+	/*&*/ T* head {this->src->__head__()};
+	const T* tail {this->src->__tail__()};
+	const T* pool {this->pool.data()};
 
-		const auto old_l {this->size()};
-		const auto new_l {old_l - a+b };
+	const auto prev {this->src->__length__()};
+	const auto old_l {this->src->size()};
 
-		if (this->capacity() < new_l)
-		{
-			out.alloc = true;
+	// one forward walk, from the first edit on; 'nth' is where 'ptr' is
+	const T* ptr {this->src->__seek__(edits.front().from)};
+	size_t nth {edits.front().from};
 
-			/**/ if (0 < step)
-			{
-				const auto dif {dest - this->__head__()};
+	const auto walk {[&](size_t until) noexcept -> size_t
+	{
+		size_t n {0};
 
-				// 2x current capacity
-				this->capacity(old_l * 2);
+		for (; nth < until && ptr < tail; ++nth, ++n) { ptr += Codec::next(ptr); }
 
-				dest = this->__head__() + dif;
-				tail = this->__tail__()      ;
-			}
-			else if (step < 0)
-			{
-				const auto dif {this->__tail__() - dest};
+		return n;
+	}};
 
-				// 2x current capacity
-				this->capacity(old_l * 2);
+	// code points taken, code points given, where the string is taken up to
+	size_t taken {0}; size_t given {0}; size_t done {0};
+	// running difference in code units; in place, the output may not overtake the input, either way
+	ptrdiff_t delta {0}; bool ltor {true}; bool rtol {true};
 
-				dest = this->__tail__() - dif;
-				tail = this->__tail__()      ;
-			}
+	for (auto& edit : edits)
+	{
+		const auto from {std::max(edit.from, done)};
+		const auto until {std::max(edit.until, from)};
+
+		walk(from);
+		const auto a {static_cast<size_t>(ptr - head)};
+		const auto n {walk(until)};
+		const auto b {static_cast<size_t>(ptr - head)};
+
+		// replaces nothing; past the end, or taken by an edit in front
+		if (n == 0 && edit.from < edit.until)
+		{
+			edit.tail = edit.head;
 		}
 
-		/**/ if (0 < step)
+		if (prev.has_value())
 		{
-			out.reuse = dest;
+			given += detail::__difcp__<Codec>(pool + edit.head, pool + edit.tail);
+		}
 
-			//                       dest
-			//                       ↓
-			//┌────────┬─────────────┬───┬──────────────┬────────┐
-			//│ <head> │ left buffer │ A │ right buffer │ <tail> │
-			//├────────┼─────────────┼───┴───┬──────────┴───┬────┴───┐
-			//│ <head> │ left buffer │ [[B]] │ right buffer │ <tail> │
-			//└────────┴─────────────┴───────┴──────────────┴────────┘
-			//                       ↑
-			//                       out.reuse
+		taken += n; done = until;
 
-			detail::__rcopy__<Codec,
-			                  Codec>
-			(
-				dest + a,
-				tail + 0,
-				dest + b
-			);
-			this->__size__(new_l);
+		delta += static_cast<ptrdiff_t>(edit.tail - edit.head) - static_cast<ptrdiff_t>(b - a);
 
-			// write code point at proper ptr
-			Codec::encode(code, out.reuse, +b);
-		}
-		else if (step < 0)
-		{
-			out.reuse = dest - a + b;
+		if (0 < delta) { ltor = false; }
+		if (delta < 0) { rtol = false; }
 
-			//                           dest
-			//                           ↓
-			//┌────────┬─────────────┬───┬──────────────┬────────┐
-			//│ <head> │ left buffer │ A │ right buffer │ <tail> │
-			//├────────┼─────────────┼───┴───┬──────────┴───┬────┴───┐
-			//│ <head> │ left buffer │ [[B]] │ right buffer │ <tail> │
-			//└────────┴─────────────┴───────┴──────────────┴────────┘
-			//                               ↑
-			//                               out.reuse
+		// from here on, in code units
+		edit.from = a; edit.until = b;
+	}
 
-			detail::__rcopy__<Codec,
-			                  Codec>
-			(
-				dest - 0 + 0,
-				tail - 0 + 0,
-				dest - a + b
-			);
-			this->__size__(new_l);
+	const auto new_l {static_cast<size_t>(static_cast<ptrdiff_t>(old_l) + delta)};
+
+	// right to left, in place, only if it fits
+	rtol = rtol && new_l <= this->src->capacity();
+
+	/**/ if (ltor)
+	{
+		// shrinks, or keeps pace; left to right, in place
+		size_t at {edits.front().from};
+		T* out {head + at};
+
+		for (const auto& edit : edits)
+		{
+			out = out != head + at ? std::copy(head + at, head + edit.from, out) : head + edit.from;
+			out = std::copy(pool + edit.head, pool + edit.tail, out);
 
-			// write code point at proper ptr
-			Codec::encode(code, out.reuse, -b);
+			at = edit.until;
+		}
+		if (out != head + at)
+		{
+			std::copy(head + at, head + old_l, out);
 		}
+
+		this->src->__size__(new_l);
+		this->src->__stale__(edits.front().from);
 	}
-	else if (b < a)
+	else if (rtol)
 	{
-		out.shift = true;
+		// grows; right to left, in place
+		size_t at {old_l};
+		T* out {head + new_l};
 
-		const T* tail {this->__tail__()};
+		for (auto it {edits.rbegin()}; it != edits.rend(); ++it)
+		{
+			out = out != head + at ? std::copy_backward(head + it->until, head + at, out) : head + it->until;
+			out = std::copy_backward(pool + it->head, pool + it->tail, out);
 
-		const auto old_l {this->size()};
-		const auto new_l {old_l - a+b };
+			at = it->from;
+		}
 
-		/**/ if (0 < step)
-		{
-			out.reuse = dest;
+		this->src->__size__(new_l);
+		this->src->__stale__(edits.front().from);
+	}
+	else
+	{
+		// grows; one allocation, of the exact size
+		str out;
 
-			//                       dest
-			//                       ↓
-			//┌────────┬─────────────┬───────┬──────────────┬────────┐
-			//│ <head> │ left buffer │ [[A]] │ right buffer │ <tail> │
-			//├────────┼─────────────┼───┬───┴──────────┬───┴────┬───┘
-			//│ <head> │ left buffer │ B │ right buffer │ <tail> │
-			//└────────┴─────────────┴───┴──────────────┴────────┘
-			//                       ↑
-			//                       out.reuse
+		out.capacity(new_l);
 
-			detail::__fcopy__<Codec,
-			                  Codec>
-			(
-				dest + a,
-				tail + 0,
-				dest + b
-			);
-			this->__size__(new_l);
+		T* dest {out.__head__()};
+		size_t at {0};
 
-			// write code point at proper ptr
-			Codec::encode(code, out.reuse, +b);
-		}
-		else if (step < 0)
+		for (const auto& edit : edits)
 		{
-			out.reuse = dest - a + b;
+			dest = std::copy(head + at, head + edit.from, dest);
+			dest = std::copy(pool + edit.head, pool + edit.tail, dest);
 
-			//                               dest
-			//                               ↓
-			//┌────────┬─────────────┬───────┬──────────────┬────────┐
-			//│ <head> │ left buffer │ [[A]] │ right buffer │ <tail> │
-			//├────────┼─────────────┼───┬───┴──────────┬───┴────┬───┘
-			//│ <head> │ left buffer │ B │ right buffer │ <tail> │
-			//└────────┴─────────────┴───┴──────────────┴────────┘
-			//                           ↑
-			//                           out.reuse
+			at = edit.until;
+		}
+		std::copy(head + at, head + old_l, dest);
 
-			detail::__fcopy__<Codec,
-			                  Codec>
-			(
-				dest - 0 + 0,
-				tail - 0 + 0,
-				dest - a + b
-			);
-			this->__size__(new_l);
+		out.__size__(new_l);
 
-			// write code point at proper ptr
-			Codec::encode(code, out.reuse, -b);
-		}
+		*this->src = std::move(out);
 	}
-	return out;
+
+	if (prev.has_value())
+	{
+		this->src->__length__(*prev - taken + given);
+	}
+	else
+	{
+		this->src->__recount__(std::nullopt, 0);
+	}
+
+	this->edits.clear();
+	this->pool.clear();
+
+	return *this->src;
 }
 
-#pragma endregion str
-#pragma region str::cursor
+#pragma endregion str::editor
+#pragma region txt
 
-template <typename Codec, typename Alloc> template <typename Iterator> constexpr auto str<Codec, Alloc>::cursor<Iterator>::operator*() const noexcept -> value_type
+template <typename Codec> constexpr auto txt<Codec>::from(decltype(__head__) head, decltype(__tail__) tail) noexcept -> std::expected<txt, error>
 {
-	switch (this->offset_tag)
-	{
-		case it_offset_relative_tag::HEAD:
-		{
-			return {this->common, this->common->ptr + this->offset, this->offset_tag, this->cursor_tag};
-		}
-		case it_offset_relative_tag::TAIL:
-		{
-			return {this->common, this->common->ptr - this->offset, this->offset_tag, this->cursor_tag};
-		}
-	}
+	if (const auto valid {detail::__check__<Codec>(head, tail)}; !valid) return std::unexpected {valid.error()};
 
-	assert(!"segfault");
-	std::unreachable();
+	return txt {head, tail};
 }
 
-template <typename Codec, typename Alloc> template <typename Iterator> constexpr auto str<Codec, Alloc>::cursor<Iterator>::operator++(   ) noexcept -> Iterator&
+#pragma endregion txt
+#pragma region txt::reader
+
+template <typename Codec /* can't own */> [[nodiscard]] constexpr txt<Codec>::reader::operator char32_t() const noexcept
 {
-	T* ptr {this->common->ptr};
+	const T* head {this->src->__head__};
+	const T* tail {this->src->__tail__};
 
-	++this->weight;
+	size_t i {0};
 
-	switch (this->offset_tag)
+	if constexpr (!Codec::is_variable
+	              &&
+	              !Codec::is_stateful)
 	{
-		case it_offset_relative_tag::HEAD:
-		{
-			ptr += this->offset;
-			break;
-		}
-		case it_offset_relative_tag::TAIL:
+		if (this->arg < this->src->size())
 		{
-			ptr -= this->offset;
-			break;
+			head += this->arg;
+			goto __SHORTCUT__;
 		}
+		return '\0';
 	}
 
-	switch (this->cursor_tag)
+	for (; head < tail; head += Codec::next(head))
 	{
-		case it_cursor_category_tag::LTOR:
-		{
-			this->offset += Codec::next(ptr);
-			break;
-		}
-		case it_cursor_category_tag::RTOL:
+		if (this->arg == i++)
 		{
-			this->offset -= Codec::back(ptr);
-			break;
+			__SHORTCUT__:
+
+			char32_t code;
+
+			const auto step {Codec::next(head)};
+			Codec::decode(head, code, step);
+
+			return code;
 		}
 	}
+	return U'\0';
+}
 
-	return static_cast<Iterator&>(*this);
+template <typename Codec /* can't own */> constexpr auto txt<Codec>::reader::operator==(char32_t code) const noexcept -> bool
+{
+	return this->operator char32_t() == code;
 }
 
-template <typename Codec, typename Alloc> template <typename Iterator> constexpr auto str<Codec, Alloc>::cursor<Iterator>::operator++(int) noexcept -> Iterator
+template <typename Codec /* can't own */> constexpr auto txt<Codec>::reader::operator!=(char32_t code) const noexcept -> bool
 {
-	cursor clone {*this}; ++(*this);
+	return this->operator char32_t() != code;
+}
 
-	return static_cast<Iterator>(clone);
+#pragma endregion txt::reader
+#pragma region txt::writer
+
+template <typename Codec /* can't own */> [[nodiscard]] constexpr txt<Codec>::writer::operator char32_t() const noexcept
+{
+	return reader {this->src, this->arg}.operator char32_t();
 }
 
-template <typename Codec, typename Alloc> template <typename Iterator> constexpr auto str<Codec, Alloc>::cursor<Iterator>::operator--(   ) noexcept -> Iterator&
+template <typename Codec /* can't own */> constexpr auto txt<Codec>::writer::operator==(char32_t code) const noexcept -> bool
 {
-	T* ptr {this->common->ptr};
+	return reader {this->src, this->arg}.operator==(code);
+}
 
-	--this->weight;
+template <typename Codec /* can't own */> constexpr auto txt<Codec>::writer::operator!=(char32_t code) const noexcept -> bool
+{
+	return reader {this->src, this->arg}.operator!=(code);
+}
 
-	switch (this->offset_tag)
+#pragma endregion txt::writer
+#pragma region searcher
+
+template <typename Codec>
+template <typename Other, typename Arena> constexpr searcher<Codec>::searcher(__OWNED__(value)) noexcept : needle {value}
+{
+	this->__init__();
+}
+
+template <typename Codec>
+template <typename Other /* can't own */> constexpr searcher<Codec>::searcher(__SLICE__(value)) noexcept : needle {value}
+{
+	this->__init__();
+}
+
+template <typename Codec>
+template <size_t                       N> constexpr searcher<Codec>::searcher(__EQSTR__(value)) noexcept requires (std::is_same_v<T, char>) : needle {value}
+{
+	this->__init__();
+}
+
+template <typename Codec>
+template <size_t                       N> constexpr searcher<Codec>::searcher(__08STR__(value)) noexcept /* encoding of char8_t is trivial */ : needle {value}
+{
+	this->__init__();
+}
+
+template <typename Codec>
+template <size_t                       N> constexpr searcher<Codec>::searcher(__16STR__(value)) noexcept /* encoding of char16_t is trivial */ : needle {value}
+{
+	this->__init__();
+}
+
+template <typename Codec>
+template <size_t                       N> constexpr searcher<Codec>::searcher(__32STR__(value)) noexcept /* encoding of char32_t is trivial */ : needle {value}
+{
+	this->__init__();
+}
+
+template <typename Codec> constexpr auto searcher<Codec>::__init__() noexcept -> void
+{
+	typedef std::make_unsigned_t<T> U;
+
+	const txt<Codec> view {this->needle};
+
+	const T* rhs_0 {view.head()};
+	const T* rhs_N {view.tail()};
+
+	const size_t len {view.size()};
+
+	this->periodic = detail::__factor__(rhs_0, rhs_N, this->ell, this->per);
+
+	bool vector {false};
+
+	if !consteval
 	{
-		case it_offset_relative_tag::HEAD:
-		{
-			ptr += this->offset;
-			break;
-		}
-		case it_offset_relative_tag::TAIL:
+		vector = detail::__isa__() != detail::isa::SCALAR;
+	}
+
+	/**/ if (len <= 32)
+	{
+		this->mode = FILTER;
+	}
+	// short period; few distinct units for Horspool to skip by
+	else if (this->periodic && this->per <= len / 4)
+	{
+		this->mode = TWO_WAY;
+	}
+	// the vector filter outruns Horspool on any tier
+	else if (vector)
+	{
+		this->mode = FILTER;
+	}
+	else
+	{
+		this->mode = HORSPOOL;
+
+		for (auto& step : this->skip) { step = len; }
+
+		for (size_t i {0}; i + 1 < len; ++i)
 		{
-			ptr -= this->offset;
-			break;
+			this->skip[static_cast<U>(rhs_0[i]) & 0xFF] = len - 1 - i;
 		}
 	}
+}
 
-	switch (this->cursor_tag)
+template <typename Codec> constexpr auto searcher<Codec>::__scan__(const T* head, const T* tail, const auto& fun) const noexcept -> void
+{
+	const txt<Codec> view {this->needle};
+
+	const T* rhs_0 {view.head()};
+	const T* rhs_N {view.tail()};
+
+	const size_t len {view.size()};
+
+	if (len == 0) return;
+
+	// work allowed before falling back to Two-Way
+	ptrdiff_t credit {16 + static_cast<ptrdiff_t>(len)};
+
+	for (const T* ptr {head}; ; ptr += len)
 	{
-		case it_cursor_category_tag::LTOR:
+		const T* hit {nullptr};
+
+		switch (this->mode)
 		{
-			this->offset -= Codec::back(ptr);
-			break;
+			case FILTER:
+			{
+				hit = detail::__filter__<T>(ptr, tail, rhs_0, len, credit);
+				break;
+			}
+			case HORSPOOL:
+			{
+				hit = detail::__horspool__<T>(ptr, tail, rhs_0, len, this->skip, credit);
+				break;
+			}
+			case TWO_WAY:
+			{
+				break;
+			}
 		}
-		case it_cursor_category_tag::RTOL:
+
+		if (hit == nullptr)
 		{
-			this->offset += Codec::next(ptr);
-			break;
+			// Two-Way; the leftover of the engines above
+			hit = detail::__twoway__(ptr, tail, rhs_0, rhs_N, this->ell, this->per, this->periodic);
 		}
-	}
 
-	return static_cast<Iterator&>(*this);
+		if (hit == nullptr || !fun(hit, hit + len)) { return; }
+
+		ptr = hit; // non-overlapping
+	}
 }
 
-template <typename Codec, typename Alloc> template <typename Iterator> constexpr auto str<Codec, Alloc>::cursor<Iterator>::operator--(int) noexcept -> Iterator
+template <typename Codec> constexpr auto searcher<Codec>::find(txt<Codec> text) const noexcept -> std::optional<txt<Codec>>
 {
-	cursor clone {*this}; --(*this);
+	std::optional<txt<Codec>> out;
 
-	return static_cast<Iterator>(clone);
+	this->__scan__(text.head(), text.tail(),
+		// on the 1st match found
+		[&](const T* head, const T* tail)
+		{
+			out.emplace(head, tail); return false;
+		}
+	);
+
+	return out;
 }
 
-template <typename Codec, typename Alloc> template <typename Iterator> constexpr auto str<Codec, Alloc>::cursor<Iterator>::operator+(size_t value) noexcept -> Iterator
+template <typename Codec> constexpr auto searcher<Codec>::count(txt<Codec> text) const noexcept -> size_t
 {
-	cursor clone {*this};
+	size_t out {0};
 
-	for (size_t i {0}; i < value; ++i) { ++clone; }
+	this->__scan__(text.head(), text.tail(),
+		// on every distinct match found
+		[&](const T*, const T*)
+		{
+			++out; return true;
+		}
+	);
 
-	return static_cast<Iterator>(clone);
+	return out;
 }
 
-template <typename Codec, typename Alloc> template <typename Iterator> constexpr auto str<Codec, Alloc>::cursor<Iterator>::operator-(size_t value) noexcept -> Iterator
+template <typename Codec> constexpr auto searcher<Codec>::split(txt<Codec> text) const noexcept -> std::vector<txt<Codec>>
 {
-	cursor clone {*this};
+	std::vector<txt<Codec>> out;
 
-	for (size_t i {0}; i < value; ++i) { --clone; }
+	const T* last {text.head()};
 
-	return static_cast<Iterator>(clone);
-}
+	this->__scan__(text.head(), text.tail(),
+		// on every distinct match found
+		[&](const T* head, const T* tail)
+		{
+			if (head != last)
+			{
+				out.emplace_back(last, head);
+
+				last = tail; // update anchor
+			}
+			return true;
+		}
+	);
 
-template <typename Codec, typename Alloc> template <typename Iterator> constexpr auto str<Codec, Alloc>::cursor<Iterator>::operator+=(size_t value) noexcept -> Iterator&
-{
-	for (size_t i {0}; i < value; ++i) { ++(*this); }
+	if (last != text.head() && last < text.tail())
+	{
+		out.emplace_back(last, text.tail());
+	}
 
-	return static_cast<Iterator&>(*this);
+	return out;
 }
 
-template <typename Codec, typename Alloc> template <typename Iterator> constexpr auto str<Codec, Alloc>::cursor<Iterator>::operator-=(size_t value) noexcept -> Iterator&
+template <typename Codec> constexpr auto searcher<Codec>::match(txt<Codec> text) const noexcept -> std::vector<txt<Codec>>
 {
-	for (size_t i {0}; i < value; ++i) { --(*this); }
+	std::vector<txt<Codec>> out;
 
-	return static_cast<Iterator&>(*this);
+	this->__scan__(text.head(), text.tail(),
+		// on every distinct match found
+		[&](const T* head, const T* tail)
+		{
+			out.emplace_back(head, tail); return true;
+		}
+	);
+
+	return out;
 }
 
-template <typename Codec, typename Alloc> template <typename Iterator> constexpr auto str<Codec, Alloc>::cursor<Iterator>::operator==(const Iterator& rhs) const noexcept -> bool
-{
-	// short-circuit; delay double ptr chasing
+#pragma endregion searcher
+#pragma region multi_searcher
 
-	return this->weight == rhs.weight // delta
-	       &&
-	       this->common->src == rhs.common->src;
+template <typename Codec>
+template <typename... Args> requires (0 < sizeof...(Args) && (std::is_constructible_v<str<Codec>, const Args&> && ...))
+constexpr multi_searcher<Codec>::multi_searcher(const Args&... needles) noexcept
+{
+	this->__init__({str<Codec> {needles}...});
 }
 
-template <typename Codec, typename Alloc> template <typename Iterator> constexpr auto str<Codec, Alloc>::cursor<Iterator>::operator!=(const Iterator& rhs) const noexcept -> bool
+template <typename Codec>
+template <std::ranges::input_range Range> requires (!std::is_constructible_v<str<Codec>, const Range&>)
+constexpr multi_searcher<Codec>::multi_searcher(const Range& needles) noexcept
 {
-	// short-circuit; delay double ptr chasing
+	std::vector<str<Codec>> tmp;
 
-	return this->weight != rhs.weight // delta
-	       ||
-	       this->common->src != rhs.common->src;
+	for (const auto& needle : needles)
+	{
+		tmp.emplace_back(needle);
+	}
+
+	this->__init__(tmp);
 }
 
-template <typename Codec, typename Alloc> template <typename Iterator> [[nodiscard]] constexpr str<Codec, Alloc>::cursor<Iterator>::state::proxy::operator char32_t() const noexcept
+template <typename Codec> constexpr auto multi_searcher<Codec>::__init__(const std::vector<str<Codec>>& needles) noexcept -> void
 {
-	char32_t code;
+	typedef std::make_unsigned_t<T> U;
 
-	switch (this->cursor_tag)
+	// byte classes; one column per distinct byte in use
+	for (const auto& needle : needles)
 	{
-		case it_cursor_category_tag::LTOR:
+		for (const T* ptr {txt<Codec> {needle}.head()}; ptr < txt<Codec> {needle}.tail(); ++ptr)
 		{
-			Codec::decode(this->needle, code, Codec::next(this->needle));
-			break;
-		}
-		case it_cursor_category_tag::RTOL:
-		{
-			Codec::decode(this->needle, code, Codec::back(this->needle));
-			break;
+			for (size_t i {0}; i < sizeof(T); ++i)
+			{
+				this->cls[(static_cast<U>(*ptr) >> (8 * i)) & 0xFF] = 1;
+			}
 		}
 	}
-	return code;
-}
 
-template <typename Codec, typename Alloc> template <typename Iterator> constexpr auto str<Codec, Alloc>::cursor<Iterator>::state::proxy::operator=(char32_t code) noexcept -> proxy&
-{
-	int8_t step;
+	for (auto& col : this->cls)
+	{
+		if (col != 0) { col = static_cast<uint16_t>(this->width++); }
+	}
 
-	// examine way
-	switch (this->cursor_tag)
+	// needle -> last needle so far that ends at the same state
+	std::vector<uint32_t> last;
+
+	this->delta.assign(this->width, NONE);
+	this->out.assign(1, NONE);
+	last.assign(1, NONE);
+
+	this->next.assign(needles.size(), NONE);
+	this->size.assign(needles.size(), 0);
+
+	// trie
+	for (uint32_t id {0}; id < needles.size(); ++id)
 	{
-		case it_cursor_category_tag::LTOR:
-		{
-			step = Codec::next(this->needle);
-			break;
-		}
-		case it_cursor_category_tag::RTOL:
+		const txt<Codec> view {needles[id]};
+
+		// never matches
+		if (view.head() == view.tail()) continue;
+
+		uint32_t state {0};
+
+		for (const T* ptr {view.head()}; ptr < view.tail(); ++ptr)
 		{
-			step = Codec::back(this->needle);
-			break;
+			for (size_t i {0}; i < sizeof(T); ++i)
+			{
+				uint32_t& edge {this->delta[state * this->width + this->cls[(static_cast<U>(*ptr) >> (8 * i)) & 0xFF]]};
+
+				if (edge == NONE)
+				{
+					edge = static_cast<uint32_t>(this->out.size());
+
+					this->delta.resize(this->delta.size() + this->width, NONE);
+					this->out.push_back(NONE);
+					last.push_back(NONE);
+				}
+				state = this->delta[state * this->width + this->cls[(static_cast<U>(*ptr) >> (8 * i)) & 0xFF]];
+			}
 		}
+
+		if (last[state] == NONE) { this->out[state] = id; } else { this->next[last[state]] = id; }
+
+		last[state] = id; this->size[id] = view.size();
 	}
 
-	const auto info {this->common->src
-	->
-	__insert__(this->needle, code, step)};
+	std::vector<uint32_t> fail (this->out.size(), 0);
+	std::vector<uint32_t> todo {0};
 
-	// refresh ptr
-	switch (this->offset_tag)
+	// breadth first; a suffix is always shallower, hence done
+	for (size_t i {0}; i < todo.size(); ++i)
 	{
-		case it_offset_relative_tag::HEAD:
+		const uint32_t state {todo[i]};
+
+		for (size_t col {0}; col < this->width; ++col)
 		{
-			if (info.alloc /* shift */)
+			uint32_t& edge {this->delta[state * this->width + col]};
+
+			if (edge == NONE)
 			{
-				this->common->ptr // ← stale
-				=
-				this->common->src->__head__();
+				// dfa; borrow the transition of the longest proper suffix
+				edge = state == 0 ? 0 : this->delta[fail[state] * this->width + col];
 			}
-			this->needle = info.reuse;
-			break;
-		}
-		case it_offset_relative_tag::TAIL:
-		{
-			if (info.alloc || info.shift)
+			else
 			{
-				this->common->ptr // ← stale
-				=
-				this->common->src->__tail__();
+				fail[edge] = state == 0 ? 0 : this->delta[fail[state] * this->width + col];
+
+				// chain the needles of the suffix after its own
+				if (last[edge] == NONE) { this->out[edge] = this->out[fail[edge]]; } else { this->next[last[edge]] = this->out[fail[edge]]; }
+
+				todo.push_back(edge);
 			}
-			this->needle = info.reuse;
-			break;
 		}
 	}
 
-	return *this;
-}
-
-template <typename Codec, typename Alloc> template <typename Iterator> constexpr auto str<Codec, Alloc>::cursor<Iterator>::state::proxy::operator==(char32_t code) const noexcept -> bool
-{
-	return this->operator char32_t() == code;
-}
-
-template <typename Codec, typename Alloc> template <typename Iterator> constexpr auto str<Codec, Alloc>::cursor<Iterator>::state::proxy::operator!=(char32_t code) const noexcept -> bool
-{
-	return this->operator char32_t() != code;
+	// premultiply, so that a step costs no multiplication
+	for (auto& edge : this->delta)
+	{
+		edge = static_cast<uint32_t>(edge * this->width) | (this->out[edge] != NONE ? FLAG : 0);
+	}
 }
 
-#pragma endregion str::cursor
-#pragma region str::reader
-
-template <typename Codec, typename Alloc> [[nodiscard]] constexpr str<Codec, Alloc>::reader::operator char32_t() const noexcept
+template <typename Codec> constexpr auto multi_searcher<Codec>::scan(txt<Codec> text, const auto& fun) const noexcept -> void
 {
-	const T* head {this->src->__head__()};
-	const T* tail {this->src->__tail__()};
+	typedef std::make_unsigned_t<T> U;
 
-	size_t i {0};
+	uint32_t state {0};
 
-	if constexpr (!Codec::is_variable
-	              &&
-	              !Codec::is_stateful)
+	for (const T* ptr {text.head()}; ptr < text.tail(); ++ptr)
 	{
-		if (this->arg < this->src->size())
+		// LSB first; a match may only end on a unit boundary
+		for (size_t i {0}; i < sizeof(T); ++i)
 		{
-			head += this->arg;
-			goto __SHORTCUT__;
+			state = this->delta[(state & ~FLAG) + this->cls[(static_cast<U>(*ptr) >> (8 * i)) & 0xFF]];
 		}
-		return '\0';
-	}
 
-	for (; head < tail; head += Codec::next(head))
-	{
-		if (this->arg == i++)
+		if (!(state & FLAG)) continue;
+
+		for (uint32_t id {this->out[(state & ~FLAG) / this->width]}; id != NONE; id = this->next[id])
 		{
-			__SHORTCUT__:
+			const txt<Codec> slice {ptr + 1 - this->size[id], ptr + 1};
 
-			char32_t code;
+			if constexpr (std::is_void_v<decltype(fun(id, slice))>)
+			{
+				fun(id, slice);
+			}
+			if constexpr (!std::is_void_v<decltype(fun(id, slice))>)
+			{
+				if (!fun(id, slice)) return;
+			}
+		}
+	}
+}
 
-			const auto step {Codec::next(head)};
-			Codec::decode(head, code, step);
+template <typename Codec> constexpr auto multi_searcher<Codec>::count(txt<Codec> text) const noexcept -> size_t
+{
+	size_t out {0};
 
-			return code;
+	this->scan(text,
+		// on every match found
+		[&](uint32_t, txt<Codec>)
+		{
+			++out;
 		}
-	}
-	return U'\0';
+	);
+
+	return out;
 }
 
-template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::reader::operator==(char32_t code) const noexcept -> bool
+#pragma endregion multi_searcher
+#pragma region split_view
+
+template <typename Codec, typename Needle> constexpr split_view<Codec, Needle>::split_view(txt<Codec> text, Needle needle) noexcept : text {text}, needle {std::move(needle)}
 {
-	return this->operator char32_t() == code;
 }
 
-template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::reader::operator!=(char32_t code) const noexcept -> bool
+template <typename Codec, typename Needle> constexpr auto split_view<Codec, Needle>::__needle__() const noexcept -> const searcher<Codec>&
 {
-	return this->operator char32_t() != code;
+	if constexpr (std::is_same_v<Needle, searcher<Codec>>)
+	{
+		return this->needle;
+	}
+	else
+	{
+		return this->needle.get();
+	}
 }
 
-#pragma endregion str::reader
-#pragma region str::writer
+template <typename Codec, typename Needle> constexpr auto split_view<Codec, Needle>::begin() const noexcept -> iterator
+{
+	return {this->text, &this->__needle__()};
+}
 
-template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::writer::operator=(char32_t code) noexcept -> writer&
+template <typename Codec, typename Needle> constexpr auto split_view<Codec, Needle>::end() const noexcept -> std::default_sentinel_t
 {
-	const T* head {this->src->__head__()};
-	const T* tail {this->src->__tail__()};
+	return std::default_sentinel;
+}
 
-	size_t i {0};
+template <typename Codec, typename Needle> constexpr split_view<Codec, Needle>::iterator::iterator(txt<Codec> text, const searcher<Codec>* needle) noexcept : text {text}, needle {needle}, last {text.head()}, ptr {text.head()}
+{
+	this->__next__();
+}
 
-	if constexpr (!Codec::is_variable
-	              &&
-	              !Codec::is_stateful)
+template <typename Codec, typename Needle> constexpr auto split_view<Codec, Needle>::iterator::__next__() noexcept -> void
+{
+	// same pieces as 'split', one at a time
+	while (const auto hit {this->needle->find(txt<Codec> {this->ptr, this->text.tail()})})
 	{
-		if (this->arg < this->src->size())
+		this->ptr = hit->tail();
+
+		if (hit->head() != this->last)
 		{
-			head += this->arg;
-			goto __SHORTCUT__;
+			this->head = this->last;
+			this->tail = hit->head();
+
+			this->last = hit->tail(); // update anchor
+			return;
 		}
-		return *this;
 	}
 
-	for (; head < tail; head += Codec::next(head))
-	{
-		if (this->arg == i++)
-		{
-			__SHORTCUT__:
+	this->ptr = this->text.tail();
 
-			const auto step {Codec::next(head)};
-			this->src->__insert__(head, code, step);
+	if (this->last != this->text.head() && this->last < this->text.tail())
+	{
+		this->head = this->last;
+		this->tail = this->text.tail();
 
-			return *this;
-		}
+		this->last = this->text.tail();
+		return;
 	}
-	return *this;
+
+	this->head = nullptr;
+	this->tail = nullptr;
 }
 
-template <typename Codec, typename Alloc> [[nodiscard]] constexpr str<Codec, Alloc>::writer::operator char32_t() const noexcept
+template <typename Codec, typename Needle> constexpr auto split_view<Codec, Needle>::iterator::operator*() const noexcept -> value_type
 {
-	return reader {this->src, this->arg}.operator char32_t();
+	return {this->head, this->tail};
 }
 
-template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::writer::operator==(char32_t code) const noexcept -> bool
+template <typename Codec, typename Needle> constexpr auto split_view<Codec, Needle>::iterator::operator++(   ) noexcept -> iterator&
 {
-	return reader {this->src, this->arg}.operator==(code);
+	this->__next__(); return *this;
 }
 
-template <typename Codec, typename Alloc> constexpr auto str<Codec, Alloc>::writer::operator!=(char32_t code) const noexcept -> bool
+template <typename Codec, typename Needle> constexpr auto split_view<Codec, Needle>::iterator::operator++(int) noexcept -> iterator
 {
-	return reader {this->src, this->arg}.operator!=(code);
+	const auto clone {*this}; ++(*this); return clone;
 }
 
-#pragma endregion str::writer
-#pragma region txt::reader
+template <typename Codec, typename Needle> constexpr auto split_view<Codec, Needle>::iterator::operator==(const iterator& rhs) const noexcept -> bool
+{
+	return this->head == rhs.head && this->tail == rhs.tail;
+}
 
-template <typename Codec /* can't own */> [[nodiscard]] constexpr txt<Codec>::reader::operator char32_t() const noexcept
+template <typename Codec, typename Needle> constexpr auto split_view<Codec, Needle>::iterator::operator==(std::default_sentinel_t) const noexcept -> bool
 {
-	const T* head {this->src->__head__};
-	const T* tail {this->src->__tail__};
+	return this->head == nullptr;
+}
 
-	size_t i {0};
+#pragma endregion split_view
+#pragma region match_view
 
-	if constexpr (!Codec::is_variable
-	              &&
-	              !Codec::is_stateful)
+template <typename Codec, typename Needle> constexpr match_view<Codec, Needle>::match_view(txt<Codec> text, Needle needle) noexcept : text {text}, needle {std::move(needle)}
+{
+}
+
+template <typename Codec, typename Needle> constexpr auto match_view<Codec, Needle>::__needle__() const noexcept -> const searcher<Codec>&
+{
+	if constexpr (std::is_same_v<Needle, searcher<Codec>>)
 	{
-		if (this->arg < this->src->size())
-		{
-			head += this->arg;
-			goto __SHORTCUT__;
-		}
-		return '\0';
+		return this->needle;
 	}
-
-	for (; head < tail; head += Codec::next(head))
+	else
 	{
-		if (this->arg == i++)
-		{
-			__SHORTCUT__:
+		return this->needle.get();
+	}
+}
 
-			char32_t code;
+template <typename Codec, typename Needle> constexpr auto match_view<Codec, Needle>::begin() const noexcept -> iterator
+{
+	return {this->text, &this->__needle__()};
+}
 
-			const auto step {Codec::next(head)};
-			Codec::decode(head, code, step);
+template <typename Codec, typename Needle> constexpr auto match_view<Codec, Needle>::end() const noexcept -> std::default_sentinel_t
+{
+	return std::default_sentinel;
+}
 
-			return code;
-		}
-	}
-	return U'\0';
+template <typename Codec, typename Needle> constexpr match_view<Codec, Needle>::iterator::iterator(txt<Codec> text, const searcher<Codec>* needle) noexcept : text {text}, needle {needle}
+{
+	this->__next__(this->text.head());
 }
 
-template <typename Codec /* can't own */> constexpr auto txt<Codec>::reader::operator==(char32_t code) const noexcept -> bool
+template <typename Codec, typename Needle> constexpr auto match_view<Codec, Needle>::iterator::__next__(const T* ptr) noexcept -> void
 {
-	return this->operator char32_t() == code;
+	if (const auto hit {this->needle->find(txt<Codec> {ptr, this->text.tail()})})
+	{
+		this->head = hit->head();
+		this->tail = hit->tail();
+		return;
+	}
+
+	this->head = nullptr;
+	this->tail = nullptr;
 }
 
-template <typename Codec /* can't own */> constexpr auto txt<Codec>::reader::operator!=(char32_t code) const noexcept -> bool
+template <typename Codec, typename Needle> constexpr auto match_view<Codec, Needle>::iterator::operator*() const noexcept -> value_type
 {
-	return this->operator char32_t() != code;
+	return {this->head, this->tail};
 }
 
-#pragma endregion txt::reader
-#pragma region txt::writer
+template <typename Codec, typename Needle> constexpr auto match_view<Codec, Needle>::iterator::operator++(   ) noexcept -> iterator&
+{
+	this->__next__(this->tail); return *this; // non-overlapping
+}
 
-template <typename Codec /* can't own */> [[nodiscard]] constexpr txt<Codec>::writer::operator char32_t() const noexcept
+template <typename Codec, typename Needle> constexpr auto match_view<Codec, Needle>::iterator::operator++(int) noexcept -> iterator
 {
-	return reader {this->src, this->arg}.operator char32_t();
+	const auto clone {*this}; ++(*this); return clone;
 }
 
-template <typename Codec /* can't own */> constexpr auto txt<Codec>::writer::operator==(char32_t code) const noexcept -> bool
+template <typename Codec, typename Needle> constexpr auto match_view<Codec, Needle>::iterator::operator==(const iterator& rhs) const noexcept -> bool
 {
-	return reader {this->src, this->arg}.operator==(code);
+	return this->head == rhs.head && this->tail == rhs.tail;
 }
 
-template <typename Codec /* can't own */> constexpr auto txt<Codec>::writer::operator!=(char32_t code) const noexcept -> bool
+template <typename Codec, typename Needle> constexpr auto match_view<Codec, Needle>::iterator::operator==(std::default_sentinel_t) const noexcept -> bool
 {
-	return reader {this->src, this->arg}.operator!=(code);
+	return this->head == nullptr;
 }
 
-#pragma endregion txt::writer
+#pragma endregion match_view
 #pragma region filesystem
 
 template <typename STRING>
 // fs I/O at your service
-auto fileof(const STRING& path) noexcept -> std::optional<std::variant
+auto fileof(const STRING& path, policy mode) noexcept -> std::optional<std::variant
                                             <
                                             	str<codec<"UTF-8">>
                                             	,
@@ -4219,6 +9873,8 @@ auto fileof(const STRING& path) noexcept -> std::optional<std::variant
 				if constexpr (!IS_BIG) write_as_native(ifs, str);
 				                  else write_as_native(ifs, str);
 
+				if (mode == policy::STRICT && !validate(str)) break;
+
 				return str;
 			}
 			case UTF8_BOM:
@@ -4230,6 +9886,8 @@ auto fileof(const STRING& path) noexcept -> std::optional<std::variant
 				if constexpr (IS_BIG) write_as_native(ifs, str);
 				                 else write_as_native(ifs, str);
 
+				if (mode == policy::STRICT && !validate(str)) break;
+
 				return str;
 			}
 			case UTF16_LE:
@@ -4241,6 +9899,8 @@ auto fileof(const STRING& path) noexcept -> std::optional<std::variant
 				if constexpr (!IS_BIG) write_as_native(ifs, str);
 				                  else write_as_foreign(ifs, str);
 
+				if (mode == policy::STRICT && !validate(str)) break;
+
 				return str;
 			}
 			case UTF16_BE:
@@ -4252,6 +9912,8 @@ auto fileof(const STRING& path) noexcept -> std::optional<std::variant
 				if constexpr (IS_BIG) write_as_native(ifs, str);
 				                 else write_as_foreign(ifs, str);
 
+				if (mode == policy::STRICT && !validate(str)) break;
+
 				return str;
 			}
 			case UTF32_LE:
@@ -4263,6 +9925,8 @@ auto fileof(const STRING& path) noexcept -> std::optional<std::variant
 				if constexpr (!IS_BIG) write_as_native(ifs, str);
 				                  else write_as_foreign(ifs, str);
 
+				if (mode == policy::STRICT && !validate(str)) break;
+
 				return str;
 			}
 			case UTF32_BE:
@@ -4274,6 +9938,8 @@ auto fileof(const STRING& path) noexcept -> std::optional<std::variant
 				if constexpr (IS_BIG) write_as_native(ifs, str);
 				                 else write_as_foreign(ifs, str);
 
+				if (mode == policy::STRICT && !validate(str)) break;
+
 				return str;
 			}
 		}
@@ -4282,6 +9948,20 @@ auto fileof(const STRING& path) noexcept -> std::optional<std::variant
 	return std::nullopt;
 }
 
+template <typename STRING>
+// fs I/O at your service; trusts the content as is
+auto fileof(const STRING& path) noexcept -> std::optional<std::variant
+                                            <
+                                            	str<codec<"UTF-8">>
+                                            	,
+                                            	str<codec<"UTF-16">>
+                                            	,
+                                            	str<codec<"UTF-32">>
+                                            >>
+{
+	return fileof(path, policy::TRUST);
+}
+
 #pragma endregion filesystem
 
 #undef __OWNED__
@@ -4305,6 +9985,12 @@ using txt32 = txt<codec<"UTF-32">>;
 #undef COPY_CONSTRUCTOR
 #undef MOVE_CONSTRUCTOR
 
+#undef X86_64
+#undef TARGET
+#undef TARGET_SSE42
+#undef TARGET_AVX2
+#undef TARGET_AVX512
+
 template <size_t N> str(const char8_t (&_)[N]) -> str<codec<"UTF-8">>;
 template <size_t N> str(const char16_t (&_)[N]) -> str<codec<"UTF-16">>;
 template <size_t N> str(const char32_t (&_)[N]) -> str<codec<"UTF-32">>;
@@ -4342,8 +10028,16 @@ template <typename Codec /* can't own */> struct std::hash<utf::txt<Codec /*##*/
 	}
 };
 
+// size() counts code units; a match for code points only if fixed width
 template <typename Codec, typename Alloc>
-inline constexpr bool std::ranges::disable_sized_range<utf::str<Codec, Alloc>> = true;
+inline constexpr bool std::ranges::disable_sized_range<utf::str<Codec, Alloc>> = Codec::is_variable || Codec::is_stateful;
 
 template <typename Codec /* can't own */>
-inline constexpr bool std::ranges::disable_sized_range<utf::txt<Codec /*##*/>> = true;
+inline constexpr bool std::ranges::disable_sized_range<utf::txt<Codec /*##*/>> = Codec::is_variable || Codec::is_stateful;
+
+// slices point into the haystack; iterators only outlive a view that refers to its needle
+template <typename Codec /* haystack */>
+inline constexpr bool std::ranges::enable_borrowed_range<utf::split_view<Codec, std::reference_wrapper<const utf::searcher<Codec>>>> = true;
+
+template <typename Codec /* haystack */>
+inline constexpr bool std::ranges::enable_borrowed_range<utf::match_view<Codec, std::reference_wrapper<const utf::searcher<Codec>>>> = true;